@@ -85,5 +85,16 @@ AgentState AgentGetState(void);
  */
 void AgentSetState(AgentState newState);
 
+/** AgentSetPolicy(*name)
+ *
+ * Picks the AI strategy the Agent places and shoots with, by its FieldPolicy
+ * name (see FieldPolicy.h). It takes effect at the next AgentInit(). Until
+ * this is called the Agent plays FIELD_POLICY_AGENT_DEFAULT.
+ *
+ * @param   *name   A registered policy name.
+ * @return  SUCCESS, or STANDARD_ERROR if no policy has that name.
+ */
+uint8_t AgentSetPolicy(const char *name);
+
 
 #endif  /*  AGENT_H */
@@ -11,6 +11,7 @@
  */
 #include <stdint.h>
 
+#include "Rng.h"
 
 /*  MODULE-LEVEL DEFINITIONS, MACROS    */
 
@@ -18,7 +19,8 @@
  * Define the dimensions of the game field. They can be overridden by
  * compile-time specifications. All references to the dimensions of the field
  * should use these constants instead of hard-coding a numeric value so that the
- * field dimensions can be changed with minimal coding changes.
+ * field dimensions can be changed with minimal coding changes. The placement
+ * tables must be regenerated with the same values (see FieldPlacement.h).
  */
 #ifndef FIELD_COLS
 #define FIELD_COLS 10
@@ -89,9 +91,86 @@ typedef struct {
     ShotResult result;  // Result of a shot at this coordinate.
 } GuessData;
 
+/**
+ * The number of squares on the field. Every square gets one bit in a
+ * FieldBitboard, so the whole field must fit within a single 64-bit word.
+ */
+#define FIELD_NUM_SQUARES (FIELD_ROWS * FIELD_COLS)
+#if FIELD_NUM_SQUARES > 64
+#error "FIELD_ROWS * FIELD_COLS must fit within a 64-bit FieldBitboard."
+#endif
+
+/** BoatSize
+ * 
+ * This enum lists the number of squares, each boat occupies (and therefore, the
+ * number of lives) that each boat has.
+ */
+typedef enum {
+    FIELD_BOAT_SIZE_SMALL = 3,
+    FIELD_BOAT_SIZE_MEDIUM = 4,
+    FIELD_BOAT_SIZE_LARGE = 5,
+    FIELD_BOAT_SIZE_HUGE = 6
+} BoatSize;
+
+/**
+ * The size of a Field's boat table: as many boats as fit on the field.
+ * FIELD_NO_BOAT marks a square that holds no numbered boat; it is never a
+ * valid number, as a 64-square field holds at most 21 boats.
+ */
+#define FIELD_MAX_BOATS (FIELD_NUM_SQUARES / FIELD_BOAT_SIZE_SMALL)
+#define FIELD_NO_BOAT 0xFF
+
+/** FieldBitboard
+ *
+ * A set of field squares, one bit per square. Square (row, col) lives at bit
+ * (row * FIELD_COLS + col), so bit 0 is the top-left square and each row
+ * occupies FIELD_COLS contiguous bits.
+ */
+typedef uint64_t FieldBitboard;
+
+/**
+ * Helpers for converting between (row, col) coordinates and bitboard indices.
+ * FIELD_BITBOARD_ALL has one bit set for every square on the field.
+ */
+#define FIELD_BITBOARD_ALL (((FieldBitboard)-1) >> (64 - FIELD_NUM_SQUARES))
+#define FIELD_BITBOARD_INDEX(row, col) ((row) * FIELD_COLS + (col))
+#define FIELD_BITBOARD_SQUARE(row, col) \
+        ((FieldBitboard)1 << FIELD_BITBOARD_INDEX(row, col))
+#define FIELD_BITBOARD_ROW(index) ((index) / FIELD_COLS)
+#define FIELD_BITBOARD_COL(index) ((index) % FIELD_COLS)
+
+/**
+ * There is one bit plane per storage status, FIELD_SQUARE_EMPTY through
+ * FIELD_SQUARE_MISS. FIELD_SQUARE_CURSOR and FIELD_SQUARE_INVALID are only
+ * used for display and error reporting, so they have no plane.
+ */
+#define FIELD_NUM_PLANES (FIELD_SQUARE_MISS + 1)
+
 /** Field
  *
  * A struct for tracking all of the necessary data for an agent's field.
+ *
+ * The planes mirror the grid: bit i of planes[p] is set when square i holds
+ * status p. They are kept in sync by every Field function that modifies the
+ * grid. Code that writes to the grid directly must call FieldSyncBitboards()
+ * afterwards.
+ *
+ * hash is a Zobrist hash of the planes and of which boats are still afloat,
+ * kept up to date the same way (see FieldGetHash()).
+ *
+ * On the player's own field, every boat added with FieldAddBoat() is also
+ * numbered. boatId holds the number of the boat on each square, and the boat
+ * table (boatType, boatLives) holds each boat's type and unhit squares, so a
+ * hit finds the boat it sank with one lookup even when several boats share a
+ * type. The per-type lives above are the sums over the table. Squares with no
+ * numbered boat hold FIELD_NO_BOAT; only ids below numBoats are valid.
+ *
+ * The members up to hugeBoatLives, the first 64 bytes, keep the offsets the
+ * prebuilt objects in objs/ use, so new members go at the end. Only that
+ * prefix is shared: HumanAgent.o keeps its fields in 64-byte buffers, and
+ * FieldInit() now writes a whole Field into them. Its weak Agent functions
+ * must therefore never be the live ones; every build that links it must
+ * also build Agent.c.
  */
 typedef struct {
     uint8_t grid[FIELD_ROWS][FIELD_COLS];
@@ -99,11 +178,20 @@ typedef struct {
     uint8_t mediumBoatLives;
     uint8_t largeBoatLives;
     uint8_t hugeBoatLives;
+    FieldBitboard planes[FIELD_NUM_PLANES];
+    uint64_t hash;
+    uint8_t boatId[FIELD_ROWS][FIELD_COLS];
+    uint8_t numBoats;
+    uint8_t boatType[FIELD_MAX_BOATS];
+    uint8_t boatLives[FIELD_MAX_BOATS];
 } Field;
 
 /**
  * Specify how many boats there exist on the field. There is 1 boat of each of
- * the 4 types, so 4 total.
+ * the 4 types, so 4 total. The AI, the placement tables and the per-type lives
+ * of Field assume this fleet; FieldAddBoat() accepts more boats of each type,
+ * up to FIELD_MAX_BOATS, and other fleets and boards are played with
+ * FieldBoard.h.
  */
 #define FIELD_NUM_BOATS 4
 
@@ -145,17 +233,50 @@ typedef enum {
     FIELD_BOAT_STATUS_HUGE = 0x08,
 } BoatStatusFlag;
 
-/** BoatSize
- * 
- * This enum lists the number of squares, each boat occupies (and therefore, the
- * number of lives) that each boat has.
+/** FieldAIState
+ *
+ * Everything FieldAIDecideGuess() remembers between shots. The caller owns it,
+ * so any number of games can be played side by side, one state per game.
+ * Initialize with FieldAIStateInit() and report every shot's result with
+ * FieldAIStateUpdate().
+ *
+ * When a boat sinks, the hits that made it up are worked out with
+ * FieldAttributeSunk(). Any hit that cannot be pinned on a sunk boat is chased
+ * next, instead of dropping back to hunting. Clear attributeSunk after
+ * FieldAIStateInit() to drop every hit on a sinking instead.
  */
-typedef enum {
-    FIELD_BOAT_SIZE_SMALL = 3,
-    FIELD_BOAT_SIZE_MEDIUM = 4,
-    FIELD_BOAT_SIZE_LARGE = 5,
-    FIELD_BOAT_SIZE_HUGE = 6
-} BoatSize;
+typedef struct {
+    uint8_t targeting;          // Nonzero while chasing a hit boat
+    uint8_t orientationKnown;   // 0 = unknown, 1 = horizontal, 2 = vertical
+    int8_t direction;           // 0 = N, 1 = S, 2 = W, 3 = E, -1 = none
+    uint8_t reverse;            // Nonzero once the far end has been reached
+    uint8_t hitsInARow;
+    uint8_t originRow;          // First hit on the current target
+    uint8_t originCol;
+    GuessData lastGuess;        // Most recent shot and its result
+
+    // Sunk-boat attribution (see FieldAttribution.h)
+    uint8_t attributeSunk;      // Nonzero to keep chasing unresolved hits
+    uint8_t resolve;            // Nonzero when a sinking is not yet attributed
+    FieldBitboard hits;         // Hits reported so far
+    FieldBitboard dead;         // Hits known to belong to sunk boats
+    uint8_t sunkSquare[FIELD_NUM_BOATS];
+    FieldBitboard hitsAtSink[FIELD_NUM_BOATS];
+
+    uint64_t rng;               // Sampling stream for FieldAIDecideGuessWithin()
+} FieldAIState;
+
+/** FieldAIStats
+ *
+ * How much search FieldAIDecideGuessWithin() finished before its deadline.
+ */
+typedef struct {
+    uint32_t elapsedMicros;     // Time spent deciding
+    uint32_t samples;           // Monte Carlo samples accepted
+    uint64_t placements;        // Fleet configurations enumerated exactly
+    uint8_t exact;              // Nonzero if the guess is from a complete enumeration
+    uint8_t opening;            // Nonzero if the guess is from the opening book
+} FieldAIStats;
 
 
 /*  PROTOTYPES  */
@@ -235,7 +356,8 @@ SquareStatus FieldSetSquareStatus(
  * times a boat can be added to a field within this function.
  * 
  * In addition, this function should update the appropriate boatLives parameter
- * of the field.
+ * of the field. The boat also gets the next free number in the field's boat
+ * table; once FIELD_MAX_BOATS boats are numbered, STANDARD_ERROR is returned.
  *
  * So this is valid test code:
  * {
@@ -285,6 +407,11 @@ uint8_t FieldAddBoat(
  * Finally this function also reduces the lives for any boat that was hit from
  * this attack.
  *
+ * A boat is reported sunk as soon as its own last square is hit, through the
+ * boat table, even while other boats of its type are afloat. Boat squares
+ * written to the grid directly carry no number and count against the lives of
+ * their type instead.
+ *
  * @param   f       The field to check against and update.
  * @param   gData   The coordinates that were guessed. The result is stored in
  *                  gData->result as an output.  The result can be a RESULT_HIT,
@@ -328,9 +455,26 @@ SquareStatus FieldUpdateKnowledge(Field *oppField, const GuessData *own_guess);
  */
 uint8_t FieldGetBoatStates(const Field *f);
 
+/** FieldGetBoatId(*f, row, col)
+ *
+ * Looks up which boat of the boat table covers a square. Its type and unhit
+ * squares are then f->boatType[id] and f->boatLives[id].
+ *
+ * @param   *f  The field being referenced.
+ * @param   row The row-component of the location to look up.
+ * @param   col The column-component of the location to look up.
+ * @return  The boat's number, or FIELD_NO_BOAT if the square is off the field
+ *          or holds no boat added with FieldAddBoat().
+ */
+uint8_t FieldGetBoatId(const Field *f, uint8_t row, uint8_t col);
+
 /** FieldAIPlaceAllBoats(*ownField)
  *
  * This function is responsible for placing all four of the boats on a field.
+ *
+ * Boats are placed largest first. Each one is drawn uniformly from the
+ * placements that still fit, so every boat costs one pass over its placement
+ * table and there are no retries.
  * 
  * @param   f   Agent's own field, to be modified in place.
  * @return  SUCCESS if all boats could be placed, STANDARD_ERROR otherwise.
@@ -339,6 +483,41 @@ uint8_t FieldGetBoatStates(const Field *f);
  */
 uint8_t FieldAIPlaceAllBoats(Field *ownField);
 
+/** FieldAIPlaceAllBoatsRng(*ownField, *rng)
+ *
+ * FieldAIPlaceAllBoats() drawing from *rng. FieldAIPlaceAllBoats() itself
+ * draws from RngDefault().
+ *
+ * @param   f       Agent's own field, to be modified in place.
+ * @param   *rng    The generator.
+ * @return  SUCCESS if all boats could be placed, STANDARD_ERROR otherwise.
+ */
+uint8_t FieldAIPlaceAllBoatsRng(Field *ownField, Rng *rng);
+
+/** FieldAIPlaceAllBoatsUniform(*ownField)
+ *
+ * Like FieldAIPlaceAllBoats(), but every whole-fleet configuration is equally
+ * likely. Placing boats one at a time favours configurations in which the
+ * later boats had few places left. Here each boat is instead drawn from all of
+ * its in-bounds placements. If the one drawn does not fit, the whole fleet is
+ * restarted. On an empty 6x10 field about two fleets are drawn per success.
+ *
+ * @param   f   Agent's own field, to be modified in place.
+ * @return  SUCCESS if all boats could be placed, STANDARD_ERROR if no fleet
+ *          fit within 1000 tries. The field is only modified on success.
+ */
+uint8_t FieldAIPlaceAllBoatsUniform(Field *ownField);
+
+/** FieldAIPlaceAllBoatsUniformRng(*ownField, *rng)
+ *
+ * FieldAIPlaceAllBoatsUniform() drawing from *rng.
+ *
+ * @param   f       Agent's own field, to be modified in place.
+ * @param   *rng    The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if no fleet fit within 1000 tries.
+ */
+uint8_t FieldAIPlaceAllBoatsUniformRng(Field *ownField, Rng *rng);
+
 /** FieldAIDecideGuess(*oppField)
  *
  * Given a field, decide the next guess.
@@ -346,8 +525,10 @@ uint8_t FieldAIPlaceAllBoats(Field *ownField);
  * This function should not attempt to shoot a square which has already been
  * guessed.
  *
- * You may wish to give this function static variables.  If so, that data should
- * be reset when FieldInit() is called.
+ * This is a wrapper around FieldAIStateDecideGuess() with a module-level
+ * state, FieldAIDefaultState(). That state is reset whenever FieldInit() is
+ * given an opponent field, and results must be reported to it with
+ * FieldAIStateUpdate().
  * 
  * @param   *f  An opponent's field.
  * @return  A GuessData struct whose row and col parameters are the coordinates
@@ -355,6 +536,204 @@ uint8_t FieldAIPlaceAllBoats(Field *ownField);
  */
 GuessData FieldAIDecideGuess(const Field *oppField);
 
+
+/*  REENTRANT AI    */
+
+/** FieldAIStateInit(*state)
+ *
+ * Prepares a state for a new game. The state's sampling stream is seeded from
+ * RngDefault().
+ *
+ * @param   *state  The state to initialize.
+ */
+void FieldAIStateInit(FieldAIState *state);
+
+/** FieldAIStateInitRng(*state, *rng)
+ *
+ * FieldAIStateInit() seeding the sampling stream from *rng.
+ *
+ * @param   *state  The state to initialize.
+ * @param   *rng    The generator.
+ */
+void FieldAIStateInitRng(FieldAIState *state, Rng *rng);
+
+/** FieldAIStateReset(*state)
+ *
+ * Drops the current target. This is done automatically when a boat is
+ * reported sunk; unresolved hits are picked up again on the next guess.
+ *
+ * @param   *state  The state to reset.
+ */
+void FieldAIStateReset(FieldAIState *state);
+
+/** FieldAIStateUpdate(*state, *ownGuess)
+ *
+ * Reports the result of a shot. Call this once per shot, with the same
+ * GuessData that was passed to FieldUpdateKnowledge().
+ *
+ * @param   *state      The state that chose the shot.
+ * @param   *ownGuess   The shot, with its result filled in.
+ */
+void FieldAIStateUpdate(FieldAIState *state, const GuessData *ownGuess);
+
+/** FieldAIStateDecideGuess(*state, *oppField)
+ *
+ * Reentrant version of FieldAIDecideGuess(). Only *state and *oppField are
+ * touched, so separate games may run on separate threads.
+ *
+ * @param   *state      This game's AI state.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldAIStateDecideGuess(FieldAIState *state, const Field *oppField);
+
+/** FieldAIDefaultState()
+ *
+ * @return  The state used by FieldAIDecideGuess().
+ */
+FieldAIState *FieldAIDefaultState(void);
+
+
+/*  ANYTIME AI  */
+
+/** FieldAIDecideGuessWithin(*oppField, *state, deadlineMicros, *stats)
+ *
+ * Picks the most likely square, doing as much search as fits before
+ * deadlineMicros and returning the best guess found by then:
+ *   0. While the field is still in the opening book (FieldOpening.h), the
+ *      book's move is exact and is returned at once.
+ *   1. The density map gives an answer almost immediately.
+ *   2. The exact solver (FieldExact.h) gets a quarter of the remaining time.
+ *      If it finishes, its answer is exact and is returned.
+ *   3. Otherwise the sampler (FieldSampler.h) runs until the deadline, and its
+ *      answer replaces the density guess if it accepted any samples. If the
+ *      solver overran, or the deadline left too little time, a short pass of
+ *      a fixed number of samples is taken anyway, a little past the deadline.
+ * The deadline can therefore be tuned per deployment at run time, from a few
+ * hundred microseconds on the Nucleo to whole milliseconds on a host.
+ *
+ * @param   *oppField       The opponent's field.
+ * @param   *state          Supplies the sampling stream; NULL uses
+ *                          FieldAIDefaultState().
+ * @param   deadlineMicros  The FieldAIMicros() time by which to return. A
+ *                          deadline already passed returns the density guess.
+ * @param   *stats          If not NULL, receives how much search was done.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldAIDecideGuessWithin(const Field *oppField, FieldAIState *state,
+                                   uint32_t deadlineMicros, FieldAIStats *stats);
+
+/** FieldAIMicros()
+ *
+ * The microsecond clock behind every AI time limit. On a host this is a
+ * monotonic clock. On the Nucleo, Lab10_main_ec.c provides it from the
+ * free-running htim2; the fallback built into Field.c uses HAL_GetTick().
+ * It wraps about every 71 minutes, so compare times by subtraction only.
+ *
+ * @return  The current time in microseconds.
+ */
+uint32_t FieldAIMicros(void);
+
+
+/*  BITBOARD QUERIES    */
+
+/** FieldSyncBitboards(*f)
+ *
+ * Rebuilds every bit plane of a field, and its hash, from its grid and boat
+ * lives. This is only needed after writing to f->grid or the lives directly;
+ * the other Field functions keep the planes in sync on their own.
+ *
+ * @param   *f  The field to resynchronize.
+ */
+void FieldSyncBitboards(Field *f);
+
+/** FieldGetBitboard(*f, p)
+ *
+ * Retrieves the set of squares that currently hold the status p. For example,
+ * FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN) is every square that has
+ * not been shot at yet.
+ *
+ * @param   *f  The field being referenced.
+ * @param   p   The status to look up.
+ * @return  A bitboard of all squares with status p, or 0 if p has no plane
+ *          (FIELD_SQUARE_CURSOR, FIELD_SQUARE_INVALID).
+ */
+FieldBitboard FieldGetBitboard(const Field *f, SquareStatus p);
+
+/** FieldGetHash(*f)
+ *
+ * Retrieves the field's Zobrist hash: the XOR of a fixed random key for each
+ * square and its status, and one for each boat still afloat. Two fields with
+ * the same squares and the same boats sunk have the same hash however the
+ * shots were ordered. Every Field function updates it with a couple of XORs
+ * per square it writes.
+ *
+ * @param   *f  The field being referenced.
+ * @return  The hash.
+ */
+uint64_t FieldGetHash(const Field *f);
+
+/** FieldBitboardCount(b)
+ *
+ * @return  The number of squares in b.
+ */
+static inline uint8_t FieldBitboardCount(FieldBitboard b)
+{
+    return (uint8_t)__builtin_popcountll(b);
+}
+
+/** FieldBitboardAnd(a, b)
+ *
+ * @return  The squares that are in both a and b.
+ */
+static inline FieldBitboard FieldBitboardAnd(FieldBitboard a, FieldBitboard b)
+{
+    return a & b;
+}
+
+/** FieldBitboardAndNot(a, b)
+ *
+ * @return  The squares that are in a but not in b.
+ */
+static inline FieldBitboard FieldBitboardAndNot(FieldBitboard a, FieldBitboard b)
+{
+    return a & ~b;
+}
+
+/** FieldBitboardFirst(b)
+ *
+ * @return  The index of the lowest square in b (scanning row by row from the
+ *          top-left), or FIELD_NUM_SQUARES if b is empty.
+ */
+static inline uint8_t FieldBitboardFirst(FieldBitboard b)
+{
+    return b ? (uint8_t)__builtin_ctzll(b) : FIELD_NUM_SQUARES;
+}
+
+/** FieldBitboardPopFirst(*b)
+ *
+ * Removes the lowest square from *b and returns its index. Useful for
+ * iterating over a set of squares:
+ * {
+ *   FieldBitboard todo = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+ *   while (todo) {
+ *       uint8_t i = FieldBitboardPopFirst(&todo);
+ *       ... FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i) ...
+ *   }
+ * }
+ *
+ * @param   *b  A non-empty bitboard, modified in place.
+ * @return  The index of the removed square.
+ */
+static inline uint8_t FieldBitboardPopFirst(FieldBitboard *b)
+{
+    uint8_t index = (uint8_t)__builtin_ctzll(*b);
+    *b &= *b - 1;
+    return index;
+}
+
 /************************************************************
  * FOR EXTRA CREDIT:  Make the two "AI" functions above     *
  * smart enough to beat our AI in more than 55% of games.   *
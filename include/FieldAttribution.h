@@ -0,0 +1,50 @@
+#ifndef FIELD_ATTRIBUTION_H
+#define FIELD_ATTRIBUTION_H
+/**
+ * @file    FieldAttribution.h
+ *
+ * Works out which hit squares belonged to the boats that have been sunk.
+ *
+ * A RESULT_*_BOAT_SUNK only says which boat went down and where the last shot
+ * landed. When boats touch, the hits around that square may belong to the
+ * sunk boat or to a neighbour that is still afloat. This module tries every
+ * way of placing the sunk boats on the known hits. Each boat must:
+ *   - lie entirely on squares that were already hit when it sank,
+ *   - cover the square whose shot sank it.
+ * An assignment is kept only if the boats still afloat can then cover every
+ * remaining hit without touching a miss.
+ *
+ * A hit is dead if it belongs to a sunk boat in every kept assignment. All
+ * other hits are unresolved and still worth targeting around.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  PROTOTYPES  */
+
+/** FieldAttributeSunk(*oppField, sunkSquare, hitsAtSink, *possible)
+ *
+ * Assigns the hits on oppField to the sunk boats.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   sunkSquare  Per BoatType, the square index of the shot that sank
+ *                      that boat, or FIELD_NUM_SQUARES if unknown.
+ * @param   hitsAtSink  Per BoatType, the hits known when that boat sank
+ *                      (including sunkSquare), or FIELD_BITBOARD_ALL if
+ *                      unknown. Entries for boats still afloat are ignored.
+ * @param   *possible   If not NULL, receives the hits that belong to a sunk
+ *                      boat in at least one assignment.
+ * @return  The hits that belong to a sunk boat in every assignment. 0 if no
+ *          boat is sunk or the field admits no assignment at all.
+ */
+FieldBitboard FieldAttributeSunk(const Field *oppField,
+                                 const uint8_t sunkSquare[FIELD_NUM_BOATS],
+                                 const FieldBitboard hitsAtSink[FIELD_NUM_BOATS],
+                                 FieldBitboard *possible);
+
+
+#endif // FIELD_ATTRIBUTION_H
@@ -0,0 +1,254 @@
+#ifndef FIELD_BOARD_H
+#define FIELD_BOARD_H
+/**
+ * @file    FieldBoard.h
+ *
+ * Boards and fleets chosen at runtime, for variant games.
+ *
+ * A FieldRules descriptor gives the board size and a list of boat types, each
+ * with a length and a count. A FieldBoard holds one side of a game under
+ * those rules. The API mirrors Field.h:
+ *   - FieldBoardInit() plays the role of FieldInit(),
+ *   - FieldBoardAddBoat() plays the role of FieldAddBoat(),
+ *   - FieldBoardRegisterAttack() plays the role of FieldRegisterEnemyAttack(),
+ *   - and so on for the rest.
+ * Each boat is numbered, so a fleet may hold several boats of one type.
+ *
+ * Boards are stored as row bitsets, up to 64 columns by 64 rows. Placement
+ * checks and the hunter's placement scan work a whole row at a time.
+ *
+ * Field itself stays the fixed 6x10, four-boat game. Its fixed-size arrays,
+ * bitboards and generated placement tables are what keep the standard game
+ * fast. Only its first 64 bytes, the grid and the four *BoatLives, keep the
+ * offsets the prebuilt objects in objs/ use; the struct has grown past them
+ * (see Field.h).
+ * FieldBoardShotsToWin() runs a game under any rules. When the rules are
+ * fieldRulesStandard it uses Field and FieldDensity directly; otherwise it
+ * goes through the generic code here.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "Rng.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * Limits on the rules a FieldBoard can hold.
+ */
+#define FIELD_BOARD_MAX_ROWS 64
+#define FIELD_BOARD_MAX_COLS 64
+#define FIELD_BOARD_MAX_TYPES 8
+#define FIELD_BOARD_MAX_BOATS 32
+
+/**
+ * Square values on a FieldBoard. Boat b is stored as FIELD_BOARD_BOAT(b).
+ * FIELD_BOARD_NO_BOAT is returned when no boat is meant.
+ */
+#define FIELD_BOARD_EMPTY 0
+#define FIELD_BOARD_BOAT(b) ((b) + 1)
+#define FIELD_BOARD_UNKNOWN 0x80
+#define FIELD_BOARD_HIT 0x81
+#define FIELD_BOARD_MISS 0x82
+#define FIELD_BOARD_NO_BOAT 0xFF
+
+/** FieldRules
+ *
+ * A board size and a fleet. Boat type t is size[t] squares long and the fleet
+ * has count[t] of them. Boats are numbered by type, then by count.
+ */
+typedef struct {
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t numTypes;
+    uint8_t size[FIELD_BOARD_MAX_TYPES];
+    uint8_t count[FIELD_BOARD_MAX_TYPES];
+} FieldRules;
+
+/** FieldBoardRow
+ *
+ * One row of a FieldBoard as a set of columns: bit c is column c.
+ */
+typedef uint64_t FieldBoardRow;
+
+/** FieldBoard
+ *
+ * One side of a game under some FieldRules, stored as one FieldBoardRow per
+ * row and per kind of square. Own boards have squares FIELD_BOARD_EMPTY,
+ * FIELD_BOARD_BOAT(b), FIELD_BOARD_HIT or FIELD_BOARD_MISS. Opponent boards
+ * have squares FIELD_BOARD_UNKNOWN, FIELD_BOARD_HIT or FIELD_BOARD_MISS.
+ *
+ * Each boat's position is kept with the boat, so boat squares need only one
+ * set of rows. A horizontal boat is a run of bits in one row. A vertical boat
+ * is the same bit in consecutive rows, so it is checked by ANDing those rows
+ * together.
+ */
+typedef struct {
+    const FieldRules *rules;
+    uint8_t opponent;                   // Nonzero for a view of the opponent
+    uint8_t numBoats;
+    uint8_t boatType[FIELD_BOARD_MAX_BOATS];
+    uint8_t lives[FIELD_BOARD_MAX_BOATS];
+    uint8_t boatRow[FIELD_BOARD_MAX_BOATS];
+    uint8_t boatCol[FIELD_BOARD_MAX_BOATS];
+    uint8_t boatDir[FIELD_BOARD_MAX_BOATS];
+    uint32_t afloat;                    // Bit b set while boat b is afloat
+    FieldBoardRow boats[FIELD_BOARD_MAX_ROWS];  // Boat squares not yet hit
+    FieldBoardRow hit[FIELD_BOARD_MAX_ROWS];
+    FieldBoardRow miss[FIELD_BOARD_MAX_ROWS];
+} FieldBoard;
+
+/**
+ * The standard game: 6x10, one boat each of length 3, 4, 5 and 6.
+ */
+extern const FieldRules fieldRulesStandard;
+
+
+/*  PROTOTYPES  */
+
+/** FieldRulesCheck(*rules)
+ *
+ * @param   *rules  The rules to check.
+ * @return  SUCCESS if the rules fit in a FieldBoard and the fleet fits on the
+ *          board square for square, STANDARD_ERROR otherwise.
+ */
+uint8_t FieldRulesCheck(const FieldRules *rules);
+
+/** FieldRulesIsStandard(*rules)
+ *
+ * @param   *rules  The rules to check.
+ * @return  Nonzero if the rules are the game Field implements.
+ */
+uint8_t FieldRulesIsStandard(const FieldRules *rules);
+
+/** FieldBoardInit(*ownBoard, *oppBoard, *rules)
+ *
+ * Clears ownBoard to FIELD_BOARD_EMPTY with every boat unplaced, and
+ * oppBoard to FIELD_BOARD_UNKNOWN with every boat afloat. Either may be NULL.
+ * The rules must outlive the boards.
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @param   *rules      Rules that pass FieldRulesCheck().
+ */
+void FieldBoardInit(FieldBoard *ownBoard, FieldBoard *oppBoard, const FieldRules *rules);
+
+/** FieldBoardGetSquare(*b, row, col)
+ *
+ * @param   *b      The board.
+ * @param   row     The row.
+ * @param   col     The column.
+ * @return  The square's value, or FIELD_BOARD_NO_BOAT if out of bounds.
+ */
+uint8_t FieldBoardGetSquare(const FieldBoard *b, uint8_t row, uint8_t col);
+
+/** FieldBoardSetSquare(*b, row, col, square)
+ *
+ * Sets one square to FIELD_BOARD_EMPTY, FIELD_BOARD_UNKNOWN, FIELD_BOARD_HIT
+ * or FIELD_BOARD_MISS, like FieldSetSquareStatus(). Boats are only added with
+ * FieldBoardAddBoat(), and a square holding a boat cannot be set.
+ *
+ * @param   *b      The board.
+ * @param   row     The row.
+ * @param   col     The column.
+ * @param   square  The new value.
+ * @return  The old value, or FIELD_BOARD_NO_BOAT if nothing was set.
+ */
+uint8_t FieldBoardSetSquare(FieldBoard *b, uint8_t row, uint8_t col, uint8_t square);
+
+/** FieldBoardGetRow(*b, square, row)
+ *
+ * The row-bitset counterpart of FieldGetBitboard(): the columns of `row` that
+ * hold `square`. Any FIELD_BOARD_BOAT(b) value gives every boat square not
+ * yet hit.
+ *
+ * @param   *b      The board.
+ * @param   square  FIELD_BOARD_EMPTY, FIELD_BOARD_UNKNOWN, FIELD_BOARD_HIT,
+ *                  FIELD_BOARD_MISS or FIELD_BOARD_BOAT(b).
+ * @param   row     The row.
+ * @return  The columns, or 0 if row is out of bounds.
+ */
+FieldBoardRow FieldBoardGetRow(const FieldBoard *b, uint8_t square, uint8_t row);
+
+/** FieldBoardAddBoat(*ownBoard, row, col, dir, boat)
+ *
+ * Places boat number `boat` with its top-left end at (row, col), the same way
+ * FieldAddBoat() does. The board is modified only if the boat fits on empty
+ * squares.
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   row, col    The top-left end of the boat.
+ * @param   dir         FIELD_DIR_SOUTH or FIELD_DIR_EAST.
+ * @param   boat        The boat, numbered as in FieldRules.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldBoardAddBoat(FieldBoard *ownBoard, uint8_t row, uint8_t col,
+                          BoatDirection dir, uint8_t boat);
+
+/** FieldBoardPlaceAllBoats(*ownBoard, *rng)
+ *
+ * Places the whole fleet at random, longest boats first. Each boat is drawn
+ * from the positions still free for it, as FieldAIPlaceAllBoats() does.
+ *
+ * @param   *ownBoard   A board with no boats yet.
+ * @param   *rng        The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if some boat had no room left.
+ */
+uint8_t FieldBoardPlaceAllBoats(FieldBoard *ownBoard, Rng *rng);
+
+/** FieldBoardRegisterAttack(*ownBoard, *guess)
+ *
+ * Applies an opponent's shot and fills in guess->result with RESULT_HIT or
+ * RESULT_MISS.
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   *guess      The shot.
+ * @return  The boat that this shot sank, or FIELD_BOARD_NO_BOAT.
+ */
+uint8_t FieldBoardRegisterAttack(FieldBoard *ownBoard, GuessData *guess);
+
+/** FieldBoardUpdateKnowledge(*oppBoard, *guess, sunkBoat)
+ *
+ * Records the result of one of the player's own shots.
+ *
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @param   *guess      The shot, with its result.
+ * @param   sunkBoat    What FieldBoardRegisterAttack() returned.
+ */
+void FieldBoardUpdateKnowledge(FieldBoard *oppBoard, const GuessData *guess, uint8_t sunkBoat);
+
+/** FieldBoardGetBoatStates(*b)
+ *
+ * @param   *b  The board.
+ * @return  One bit per boat, set while that boat is afloat.
+ */
+uint32_t FieldBoardGetBoatStates(const FieldBoard *b);
+
+/** FieldBoardDecideGuess(*oppBoard)
+ *
+ * The FieldDensityDecideGuess() hunter under any rules. Each unknown square
+ * is scored by the placements of the boats still afloat that cover it.
+ * Placements that cover a hit count FIELD_DENSITY_HIT_WEIGHT times more.
+ *
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldBoardDecideGuess(const FieldBoard *oppBoard);
+
+/** FieldBoardShotsToWin(*rules, *rng)
+ *
+ * Places a random fleet under `rules` and counts the shots the density hunter
+ * needs to sink it. The standard rules take the Field fast path.
+ *
+ * @param   *rules  Rules that pass FieldRulesCheck().
+ * @param   *rng    The generator for the fleet.
+ * @return  The number of shots.
+ */
+uint16_t FieldBoardShotsToWin(const FieldRules *rules, Rng *rng);
+
+
+#endif // FIELD_BOARD_H
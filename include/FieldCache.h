@@ -0,0 +1,159 @@
+#ifndef FIELD_CACHE_H
+#define FIELD_CACHE_H
+/**
+ * @file    FieldCache.h
+ *
+ * A transposition cache for analysed opponent fields.
+ *
+ * Self-play keeps reaching the same opponent field, with the same hits,
+ * misses and boats sunk, through different games and shot orders. The field's
+ * Zobrist hash (FieldGetHash()) names that state without regard to order, so
+ * an analysis done once can be looked up the next time. An entry holds the
+ * best guess and the hit probability of every square, to 1/255.
+ *
+ * The cache is a fixed array of slots owned by the caller, indexed directly
+ * by the low bits of the key. A store replaces what was there. Neither reads
+ * nor stores take a lock, so several threads can share one cache. Each slot is
+ * a seqlock: a store makes its sequence number odd, writes the key and entry,
+ * then makes it even again, and a lookup that finds it odd, or changed by the
+ * end of its copy, reads as a miss. Every word of a slot is an atomic, so this
+ * is race-free under C11. A store that finds another store under way in its
+ * slot is dropped, which a cache can afford.
+ *
+ * The same field analysed in different ways has different answers, so the key
+ * also names the analysis (FieldCacheKind). The counters live in a
+ * FieldCacheStats of the caller's, which keeps them exact with several
+ * threads. The hit rate over a run, against the number of entries, tells how
+ * large to make the cache.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/** FieldCacheKind
+ *
+ * The analyses that are cached. Only complete, deterministic analyses are
+ * stored, so a hit gives the same guess the analysis would have.
+ */
+typedef enum {
+    FIELD_CACHE_EXACT,          // FieldExactSolve() and FieldExactBestGuess()
+    FIELD_CACHE_ENTROPY,        // FieldEntropyExact() and FieldEntropyBestGuess()
+    FIELD_CACHE_NUM_KINDS
+} FieldCacheKind;
+
+/** FieldCacheEntry
+ *
+ * One analysed field, as stored and looked up.
+ */
+typedef struct {
+    uint8_t square;                     // Best guess (FIELD_BITBOARD_INDEX())
+    uint8_t prob[FIELD_NUM_SQUARES];    // Hit probability in 1/255ths
+} FieldCacheEntry;
+
+// 64-bit words a FieldCacheEntry is copied through
+#define FIELD_CACHE_ENTRY_WORDS ((sizeof(FieldCacheEntry) + 7) / 8)
+
+/** FieldCacheSlot
+ *
+ * Where the cache keeps one entry. seq is odd while a store is writing it, and
+ * 0 until the first store. Only FieldCache.c touches the fields.
+ */
+typedef struct {
+    _Atomic uint32_t seq;
+    _Atomic uint64_t key;
+    _Atomic uint64_t word[FIELD_CACHE_ENTRY_WORDS];
+} FieldCacheSlot;
+
+/** FieldCache
+ *
+ * count is a power of two. Initialize with FieldCacheInit().
+ */
+typedef struct {
+    FieldCacheSlot *slots;
+    uint32_t count;
+} FieldCache;
+
+/** FieldCacheStats
+ *
+ * Counters for one user of a cache. Zero it to start counting.
+ */
+typedef struct {
+    uint32_t lookups;
+    uint32_t hits;
+    uint32_t stores;
+    uint32_t evictions;         // Stores over an entry for another state
+} FieldCacheStats;
+
+
+/*  PROTOTYPES  */
+
+/** FieldCacheInit(*cache, *slots, count)
+ *
+ * Sets up a cache over caller-owned storage and empties it.
+ *
+ * @param   *cache      The cache.
+ * @param   *slots      Storage for count entries.
+ * @param   count       The number of entries, a power of two.
+ * @return  SUCCESS, or STANDARD_ERROR if count is not a power of two.
+ */
+uint8_t FieldCacheInit(FieldCache *cache, FieldCacheSlot *slots, uint32_t count);
+
+/** FieldCacheClear(*cache)
+ *
+ * Empties a cache. Not safe while another thread is using it.
+ *
+ * @param   *cache  The cache.
+ */
+void FieldCacheClear(FieldCache *cache);
+
+/** FieldCacheKey(*oppField, kind)
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   kind        The analysis.
+ * @return  The key for that analysis of that field.
+ */
+uint64_t FieldCacheKey(const Field *oppField, FieldCacheKind kind);
+
+/** FieldCacheLookup(*cache, key, *entry, *stats)
+ *
+ * Copies out the entry for key, if the cache holds it and no store changed it
+ * during the copy.
+ *
+ * @param   *cache  The cache.
+ * @param   key     From FieldCacheKey().
+ * @param   *entry  Receives the entry on a hit.
+ * @param   *stats  Counters to update, or NULL.
+ * @return  SUCCESS on a hit, STANDARD_ERROR on a miss.
+ */
+uint8_t FieldCacheLookup(const FieldCache *cache, uint64_t key, FieldCacheEntry *entry,
+                         FieldCacheStats *stats);
+
+/** FieldCacheStore(*cache, key, *entry, *stats)
+ *
+ * Stores an entry for key, replacing whatever shares its slot, unless another
+ * store is writing that slot.
+ *
+ * @param   *cache  The cache.
+ * @param   key     From FieldCacheKey().
+ * @param   *entry  The best guess and probabilities.
+ * @param   *stats  Counters to update, or NULL.
+ */
+void FieldCacheStore(FieldCache *cache, uint64_t key, const FieldCacheEntry *entry,
+                     FieldCacheStats *stats);
+
+/** FieldCacheGuess(*entry)
+ *
+ * @param   *entry  A cache entry.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the entry's best guess.  The result parameter is irrelevant.
+ */
+GuessData FieldCacheGuess(const FieldCacheEntry *entry);
+
+
+#endif // FIELD_CACHE_H
@@ -0,0 +1,114 @@
+#ifndef FIELD_DENSITY_H
+#define FIELD_DENSITY_H
+/**
+ * @file    FieldDensity.h
+ *
+ * Probability-density targeting for the opponent's field. For every square,
+ * the engine counts how many legal placements of each still-alive boat cover
+ * that square, and fires at the square with the highest count.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * A placement that covers known hits is far more likely than one in open
+ * water. Each covered hit multiplies the weight of a placement by this factor,
+ * which is what turns the density map into a target-mode search after a hit.
+ * A boat covers at most 6 hits, so 16^6 times the placements through one
+ * square still fits in a uint32_t.
+ */
+#define FIELD_DENSITY_HIT_WEIGHT 16
+
+/** FieldDensityMap
+ *
+ * A density map that is kept up to date across turns instead of being rebuilt
+ * for every shot. It remembers the misses, hits and alive boats it was built
+ * from. FieldDensityMapUpdate() then only revisits the placements that pass
+ * through a newly shot square or belong to a newly sunk boat.
+ *
+ * Unlike FieldDensityCompute(), every square is tallied, including hits, so
+ * that the map can be updated without knowing which squares were unknown
+ * before.
+ */
+typedef struct {
+    uint32_t density[FIELD_NUM_SQUARES];
+    FieldBitboard misses;
+    FieldBitboard hits;
+    uint8_t alive;
+} FieldDensityMap;
+
+
+/*  PROTOTYPES  */
+
+/** FieldDensityCompute(*oppField, density)
+ *
+ * Fills density[] with the weighted number of legal placements of each alive
+ * boat that cover each square. A placement is legal if it lies within the
+ * field and covers no FIELD_SQUARE_MISS. A boat is alive if its lives on
+ * oppField are nonzero, as maintained by FieldUpdateKnowledge().
+ *
+ * Only FIELD_SQUARE_UNKNOWN squares receive a density; every other square is
+ * set to 0 so that the result can be used directly for choosing a shot.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   density     Output, indexed by FIELD_BITBOARD_INDEX(row, col).
+ */
+void FieldDensityCompute(const Field *oppField, uint32_t density[FIELD_NUM_SQUARES]);
+
+/** FieldDensityDecideGuess(*oppField)
+ *
+ * Density-based replacement for FieldAIDecideGuess(). Fires at the unknown
+ * square with the highest density, breaking ties by scan order. If no
+ * placement is legal (which only happens on an inconsistent field), the first
+ * unknown square is used instead.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldDensityDecideGuess(const Field *oppField);
+
+/** FieldDensityMapInit(*map, *oppField)
+ *
+ * Builds a map from scratch for oppField.
+ *
+ * @param   *map        The map to fill.
+ * @param   *oppField   The opponent's field.
+ */
+void FieldDensityMapInit(FieldDensityMap *map, const Field *oppField);
+
+/** FieldDensityMapUpdate(*map, *oppField)
+ *
+ * Brings a map up to date with oppField. It handles any number of new shots
+ * since the last update:
+ *   - a new miss subtracts every live placement through that square,
+ *   - a new hit re-weights every live placement through that square,
+ *   - a newly sunk boat subtracts all of that boat's placements.
+ * If oppField has lost knowledge that the map was built on (a new game, or a
+ * square changed back), the map is rebuilt instead.
+ *
+ * @param   *map        A map built by FieldDensityMapInit().
+ * @param   *oppField   The opponent's field.
+ * @return  1 if the map was updated incrementally, 0 if it was rebuilt.
+ */
+uint8_t FieldDensityMapUpdate(FieldDensityMap *map, const Field *oppField);
+
+/** FieldDensityMapBestGuess(*map, *oppField)
+ *
+ * Same choice as FieldDensityDecideGuess(), taken from an up-to-date map.
+ *
+ * @param   *map        A map that is up to date with oppField.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldDensityMapBestGuess(const FieldDensityMap *map, const Field *oppField);
+
+
+#endif // FIELD_DENSITY_H
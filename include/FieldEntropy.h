@@ -0,0 +1,150 @@
+#ifndef FIELD_ENTROPY_H
+#define FIELD_ENTROPY_H
+/**
+ * @file    FieldEntropy.h
+ *
+ * Information-gain targeting for the opponent's field.
+ *
+ * The other hunters fire at the square most likely to hit. A shot also tells
+ * the hunter something: a miss or a hit, or which boat it sank. The outcome
+ * is fixed by the opponent's fleet, so the expected information from a shot
+ * is the entropy of its outcome over the posterior. That is highest where a
+ * shot is least predictable, and a shot that can sink one of several boats
+ * says more than a plain hit. FieldEntropyBestGuess() scores each unknown
+ * square as its hit probability plus FIELD_ENTROPY_INFO_WEIGHT times its
+ * outcome entropy in bits, and fires at the best one.
+ *
+ * The outcome distribution of every square comes from fleet configurations,
+ * counted in a FieldEntropy:
+ *   - FieldEntropyExact() enumerates them all with
+ *     FieldExactCountPlacements(). Each counted placement adds to the squares
+ *     it covers, or to the sink count of the one unknown square it has left.
+ *   - FieldEntropySample() draws them with FieldSamplerDrawBoats(). Its
+ *     counters are bit-sliced: 60 of them are kept side by side across
+ *     FIELD_ENTROPY_TALLY_BITS bitboards, so one configuration is added with a
+ *     few word operations instead of one increment per square.
+ * Scoring looks up -p log2 p in a 257-entry table, so scoring all 60 squares
+ * is a few hundred integer operations, about one density pass.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "Rng.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * How much a bit of expected information is worth against a certain hit,
+ * in 1/256ths. 0 is pure hit probability.
+ */
+#ifndef FIELD_ENTROPY_INFO_WEIGHT
+#define FIELD_ENTROPY_INFO_WEIGHT 64
+#endif
+
+/**
+ * FieldEntropyDecideGuess() solves exactly when it can within this budget,
+ * and samples otherwise.
+ */
+#ifndef FIELD_ENTROPY_EXACT_BUDGET_US
+#define FIELD_ENTROPY_EXACT_BUDGET_US 2000
+#endif
+
+/**
+ * Depth of the bit-sliced sample counters. They are folded into the
+ * FieldEntropy counts before they can overflow.
+ */
+#define FIELD_ENTROPY_TALLY_BITS 16
+
+/** FieldEntropy
+ *
+ * Outcome counts over a set of fleet configurations. cover[i] counts those
+ * with a boat on square i; sink[t][i] counts those in which a shot at i sinks
+ * boat t. Known squares are not counted. uint32_t is enough for the 6x10
+ * field, which has about 3 million configurations.
+ */
+typedef struct {
+    uint32_t cover[FIELD_NUM_SQUARES];
+    uint32_t sink[FIELD_NUM_BOATS][FIELD_NUM_SQUARES];
+    uint32_t total;
+} FieldEntropy;
+
+
+/*  PROTOTYPES  */
+
+/** FieldEntropyExact(*entropy, *oppField, budgetMicros)
+ *
+ * Counts outcomes over every configuration consistent with oppField.
+ *
+ * @param   *entropy        Receives the counts.
+ * @param   *oppField       The opponent's field.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @return  The number of configurations, or 0 if there are none or the time
+ *          ran out; the counts are only usable if it is nonzero.
+ */
+uint32_t FieldEntropyExact(FieldEntropy *entropy, const Field *oppField, uint32_t budgetMicros);
+
+/** FieldEntropySample(*entropy, *oppField, *rng, maxSamples, budgetMicros)
+ *
+ * Counts outcomes over sampled configurations, with the same limits as
+ * FieldSamplerRun().
+ *
+ * @param   *entropy        Receives the counts.
+ * @param   *oppField       The opponent's field.
+ * @param   *rng            xorshift64* state, as in FieldSampler.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldEntropySample(FieldEntropy *entropy, const Field *oppField, uint64_t *rng,
+                            uint32_t maxSamples, uint32_t budgetMicros);
+
+/** FieldEntropyBits(*entropy, square)
+ *
+ * @param   *entropy    Counts from FieldEntropyExact() or FieldEntropySample().
+ * @param   square      A square index.
+ * @return  The entropy of a shot's outcome there, in bits with 12 fractional
+ *          bits.
+ */
+uint32_t FieldEntropyBits(const FieldEntropy *entropy, uint8_t square);
+
+/** FieldEntropyBestGuess(*entropy, *oppField)
+ *
+ * Picks the unknown square with the best blend of hit probability and outcome
+ * entropy. Falls back to FieldDensityDecideGuess() if nothing was counted.
+ *
+ * @param   *entropy    Counts for oppField.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyBestGuess(const FieldEntropy *entropy, const Field *oppField);
+
+/** FieldEntropyDecideGuess(*oppField)
+ *
+ * Information-gain counterpart of FieldAIDecideGuess(). It solves exactly
+ * within FIELD_ENTROPY_EXACT_BUDGET_US and otherwise samples with the
+ * sampler's default limits, drawing from RngDefault().
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyDecideGuess(const Field *oppField);
+
+/** FieldEntropyDecideGuessRng(*oppField, *rng)
+ *
+ * FieldEntropyDecideGuess() drawing from *rng, which keeps games reproducible
+ * and lets each thread use a generator of its own.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *rng        The generator.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyDecideGuessRng(const Field *oppField, Rng *rng);
+
+
+#endif // FIELD_ENTROPY_H
@@ -0,0 +1,122 @@
+#ifndef FIELD_EXACT_H
+#define FIELD_EXACT_H
+/**
+ * @file    FieldExact.h
+ *
+ * Exact solver for the opponent's field. Every full-fleet configuration that
+ * agrees with the known hits, misses and sunk boats is enumerated. This gives
+ * the exact posterior hit probability of every square, with no sampling noise.
+ *
+ * The consistency rules are the same as in FieldSampler.h, and so are the
+ * candidate lists (FieldSamplerPrepare()). Boats are placed one at a time
+ * with bitboard overlap tests. A branch is cut as soon as the remaining boats
+ * are too small to cover the hits that are still uncovered. The last boat is
+ * not recursed into: each of its candidates is checked and counted directly.
+ *
+ * A fresh 6x10 field has about 3 million configurations and takes roughly
+ * 15 ms to solve on a desktop. After ten shots a solve takes well under a
+ * millisecond. On the Nucleo, use the sampler until the field has narrowed
+ * down.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/** FieldExact
+ *
+ * Result of one solve. tally[i] / total is the probability that a boat
+ * covers square i. An incomplete solve has only counted part of the search,
+ * so its tallies are biased and should not be used.
+ */
+typedef struct {
+    uint64_t tally[FIELD_NUM_SQUARES];  // Configurations covering each square
+    uint64_t total;                     // Consistent configurations
+    uint8_t complete;                   // Zero if the solve ran out of time
+} FieldExact;
+
+
+/*  PROTOTYPES  */
+
+/** FieldExactSolve(*exact, *oppField)
+ *
+ * Enumerates every fleet configuration consistent with oppField and counts, for
+ * every square, how many of them cover it. Known hits are counted too, so
+ * their tally always equals the total.
+ *
+ * @param   *exact      Receives the tallies.
+ * @param   *oppField   The opponent's field.
+ * @return  The number of consistent configurations, 0 if there are none.
+ */
+uint64_t FieldExactSolve(FieldExact *exact, const Field *oppField);
+
+/** FieldExactSolveWithin(*exact, *oppField, budgetMicros)
+ *
+ * FieldExactSolve() with a time limit, measured with FieldAIMicros(). If the
+ * limit is reached, the solve stops with exact->complete cleared.
+ *
+ * @param   *exact          Receives the tallies.
+ * @param   *oppField       The opponent's field.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @return  The number of configurations counted, which is the exact total
+ *          only if exact->complete is set.
+ */
+uint64_t FieldExactSolveWithin(FieldExact *exact, const Field *oppField, uint32_t budgetMicros);
+
+/** FieldExactCountPlacements(*oppField, count, budgetMicros, *complete)
+ *
+ * The solve behind FieldExactSolveWithin(), before its counts are folded into
+ * squares: count[p] is the number of consistent configurations that put a
+ * boat on fieldPlacements[p]. Callers that need to know which boat covers a
+ * square, such as FieldEntropy.h, start from these.
+ *
+ * @param   *oppField       The opponent's field.
+ * @param   count           Output, indexed like fieldPlacements.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @param   *complete       Set to zero if the limit was reached, in which case
+ *                          the counts are partial.
+ * @return  The number of configurations counted.
+ */
+uint64_t FieldExactCountPlacements(const Field *oppField, uint64_t count[FIELD_NUM_PLACEMENTS],
+                                   uint32_t budgetMicros, uint8_t *complete);
+
+/** FieldExactProbabilities(*exact, prob)
+ *
+ * Converts the tallies of a solve into probabilities.
+ *
+ * @param   *exact      A result filled by FieldExactSolve().
+ * @param   prob        Output, indexed by FIELD_BITBOARD_INDEX(row, col). All
+ *                      zero if the field had no consistent configuration.
+ */
+void FieldExactProbabilities(const FieldExact *exact, double prob[FIELD_NUM_SQUARES]);
+
+/** FieldExactBestGuess(*exact, *oppField)
+ *
+ * Picks the unknown square with the highest probability. If there are no
+ * configurations, falls back to FieldDensityDecideGuess().
+ *
+ * @param   *exact      A result filled by FieldExactSolve().
+ * @param   *oppField   The same field that was solved.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldExactBestGuess(const FieldExact *exact, const Field *oppField);
+
+/** FieldExactDecideGuess(*oppField)
+ *
+ * Exact replacement for FieldAIDecideGuess(): solves oppField and returns the
+ * most likely unknown square.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldExactDecideGuess(const Field *oppField);
+
+
+#endif // FIELD_EXACT_H
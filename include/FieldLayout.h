@@ -0,0 +1,94 @@
+#ifndef FIELD_LAYOUT_H
+#define FIELD_LAYOUT_H
+/**
+ * @file    FieldLayout.h
+ *
+ * A weighted table of fleet layouts that survive long against known hunters,
+ * and a placement function that draws from it.
+ *
+ * The table is written to src/FieldLayoutTable.c by tools/FieldLayoutOpt.c
+ * (`$ make layouts`). The optimizer draws uniform fleets with
+ * FieldCountSample(). It plays each fleet against the hunters this repo ships:
+ *   - the FieldAIDecideGuess() parity scan with sunk-boat attribution,
+ *   - the FieldDensityDecideGuess() density hunter.
+ * It keeps the FIELD_NUM_LAYOUTS fleets with the highest average
+ * shots-to-win. Each one is weighted by how far it beats the weakest fleet
+ * kept. The header of the generated file records the confidence intervals
+ * measured against a uniform placement.
+ *
+ * The table is only as good as its match with the hunters it was tuned
+ * against. Run `$ make layouts` again and commit the result after any change
+ * to FieldAIStateDecideGuess(), FieldDensityDecideGuess() or the order of Rng
+ * draws. Otherwise the committed table and the intervals in its header go
+ * stale.
+ *
+ * A fixed table is predictable. An opponent that learns from past games will
+ * find it eventually, so use FieldAIPlaceAllBoatsUniform() against unknown
+ * opponents.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_NUM_LAYOUTS 256
+
+/** FieldLayout
+ *
+ * One fleet, as an index into fieldPlacements per BoatType, and its weight.
+ * The indices fit in a uint8_t as long as FIELD_NUM_PLACEMENTS is at most 256,
+ * which holds for the 6x10 field.
+ */
+typedef struct {
+    uint8_t placement[FIELD_NUM_BOATS];
+    uint8_t weight;
+} FieldLayout;
+
+
+/*  TABLES  */
+
+/**
+ * The tuned layouts, and the sum of their weights.
+ */
+extern const FieldLayout fieldLayouts[FIELD_NUM_LAYOUTS];
+extern const uint16_t fieldLayoutWeightTotal;
+
+
+/*  PROTOTYPES  */
+
+/** FieldLayoutPlace(*layout, *ownField)
+ *
+ * Adds the boats of one layout to ownField with FieldAddBoat().
+ *
+ * @param   *layout     The layout to place.
+ * @param   *ownField   A field with no boats yet.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldLayoutPlace(const FieldLayout *layout, Field *ownField);
+
+/** FieldAIPlaceAllBoatsTuned(*ownField)
+ *
+ * Places a layout drawn from fieldLayouts by weight, using RngDefault().
+ *
+ * @param   *ownField   A field with no boats yet.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldAIPlaceAllBoatsTuned(Field *ownField);
+
+/** FieldAIPlaceAllBoatsTunedRng(*ownField, *rng)
+ *
+ * FieldAIPlaceAllBoatsTuned() drawing from *rng.
+ *
+ * @param   *ownField   A field with no boats yet.
+ * @param   *rng        The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldAIPlaceAllBoatsTunedRng(Field *ownField, Rng *rng);
+
+
+#endif // FIELD_LAYOUT_H
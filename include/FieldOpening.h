@@ -0,0 +1,70 @@
+#ifndef FIELD_OPENING_H
+#define FIELD_OPENING_H
+/**
+ * @file    FieldOpening.h
+ *
+ * An opening book: the first shots of a game, worked out ahead of time.
+ *
+ * Until the first boat sinks, the best shot depends only on which squares
+ * have been shot and which of them hit. The book is a binary tree over the
+ * first FIELD_OPENING_DEPTH shots, stored heap-style: node 0 is the first
+ * shot, and node n's shot is followed by node 2n + 1 on a miss or node
+ * 2n + 2 on a hit. Each node holds the square with the highest exact
+ * posterior hit probability (FieldExactSolve()) for the field it stands for.
+ * A fresh field takes about 15 ms to solve on a desktop and far longer on the
+ * Nucleo. The book answers in at most FIELD_OPENING_DEPTH steps.
+ *
+ * FieldOpeningLookup() needs no state of its own. It walks the tree along the
+ * shots already on the field and gives up once the field leaves the book:
+ *   - a shot was made that the book did not call for,
+ *   - a boat has sunk,
+ *   - the tree is exhausted.
+ * FieldAIDecideGuessWithin(), and through it the "anytime" policy, and the
+ * "exact" policy consult the book first.
+ *
+ * The table is written to src/FieldOpeningTable.c by tools/FieldOpeningGen.c
+ * (`$ make opening`). Regenerate it whenever the field dimensions or boat
+ * sizes change.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_OPENING_DEPTH 8
+#define FIELD_OPENING_NODES ((1 << FIELD_OPENING_DEPTH) - 1)
+
+/**
+ * A node with no book move: the book ends there.
+ */
+#define FIELD_OPENING_NONE 0xFF
+
+
+/*  TABLES  */
+
+/**
+ * The book: per node, a square index (FIELD_BITBOARD_INDEX()) or
+ * FIELD_OPENING_NONE.
+ */
+extern const uint8_t fieldOpeningBook[FIELD_OPENING_NODES];
+
+
+/*  PROTOTYPES  */
+
+/** FieldOpeningLookup(*oppField, *guess)
+ *
+ * Looks up the book move for a field.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *guess      Receives the book move if there is one; its result
+ *                      parameter is irrelevant.
+ * @return  SUCCESS, or STANDARD_ERROR if the field is out of the book.
+ */
+uint8_t FieldOpeningLookup(const Field *oppField, GuessData *guess);
+
+
+#endif // FIELD_OPENING_H
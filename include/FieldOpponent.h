@@ -0,0 +1,189 @@
+#ifndef FIELD_OPPONENT_H
+#define FIELD_OPPONENT_H
+/**
+ * @file    FieldOpponent.h
+ *
+ * A learned prior over where one opponent puts its boats.
+ *
+ * People and other firmware rarely place fleets uniformly: they favour edges,
+ * corners, the middle or a few pet layouts. A FieldOpponent counts, for every
+ * entry of fieldPlacements, how often that opponent's boats were found there.
+ * At the end of each game FieldOpponentLearn() reads the sunk boats off the
+ * final opponent field. Every placement of a sunk boat's type that lies on
+ * hits only, and covers the square that sank it, shares one observation.
+ * Boats left afloat are not counted, since their position is still unknown.
+ *
+ * FieldOpponentDecideGuess() is FieldDensityDecideGuess() with each
+ * placement's weight scaled by the prior. A placement's scale is its count
+ * against the average count for its boat type, smoothed by
+ * FIELD_OPPONENT_SMOOTHING. A model with no games behaves exactly like the
+ * density hunter. The "model" policy in FieldPolicy.h plays this way, with
+ * its FieldOpponent behind FieldPolicyState.user.
+ *
+ * The struct is its own storage format: fixed-size fields, no pointers,
+ * little-endian like both the host and the Cortex-M4. A saved file can be
+ * read back with fread() or mapped with mmap() and used in place.
+ * FieldOpponentCheck() validates either.
+ *
+ * On the Nucleo there is one model, with id 0, in a flash sector, and it is
+ * shared by every opponent the board plays. The BattleBoats protocol gives the
+ * board nothing that names its opponent, so it cannot tell them apart; the
+ * model learns how opponents place in general, and is only per-opponent when
+ * the board keeps meeting the same one. On a host, callers that know who they
+ * are playing keep one model per opponent, each in its own file.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_OPPONENT_MAGIC 0x4D4F4242     // "BBOM" in a little-endian file
+#define FIELD_OPPONENT_VERSION 1
+
+/**
+ * One observation adds this much, split over the placements it could have
+ * been. The prior is smoothed by the same amount per placement, so one game
+ * moves a placement's weight at most from 1x to 2x its type's average.
+ */
+#define FIELD_OPPONENT_UNIT 16
+#define FIELD_OPPONENT_SMOOTHING FIELD_OPPONENT_UNIT
+
+/**
+ * Prior scales are fixed-point with this many fractional bits.
+ */
+#define FIELD_OPPONENT_SCALE_BITS 8
+
+/**
+ * Flash storage on the Nucleo-F411RE. The sectors below hold the vector table
+ * and code, so the model goes in the last 128 KB sector. platformio.ini keeps
+ * the firmware out of it by capping the image at
+ * FIELD_OPPONENT_FLASH_ADDRESS - 0x08000000 bytes (board_upload.maximum_size),
+ * so a build that would grow into the sector fails instead of being erased by
+ * FieldOpponentFlashSave(). Override both together for other parts, and move
+ * that cap with them.
+ */
+#ifndef FIELD_OPPONENT_FLASH_SECTOR
+#define FIELD_OPPONENT_FLASH_SECTOR 7
+#define FIELD_OPPONENT_FLASH_ADDRESS 0x08060000u
+#endif
+
+/** FieldOpponent
+ *
+ * The prior for one opponent. count[p] is in FIELD_OPPONENT_UNIT units per
+ * observation. When a count would overflow, every count is halved, so old
+ * games fade as new ones arrive. checksum covers every byte before it.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t numPlacements;                 // FIELD_NUM_PLACEMENTS
+    uint32_t id;                            // Caller's name for the opponent
+    uint32_t games;                         // Games learned from
+    uint16_t count[FIELD_NUM_PLACEMENTS];
+    uint32_t checksum;
+} FieldOpponent;
+
+
+/*  PROTOTYPES  */
+
+/** FieldOpponentInit(*model, id)
+ *
+ * Clears a model to the uniform prior.
+ *
+ * @param   *model  The model.
+ * @param   id      Any number identifying the opponent.
+ */
+void FieldOpponentInit(FieldOpponent *model, uint32_t id);
+
+/** FieldOpponentCheck(*model)
+ *
+ * @param   *model  A model read from storage.
+ * @return  SUCCESS if its magic, version, size and checksum are right,
+ *          STANDARD_ERROR otherwise.
+ */
+uint8_t FieldOpponentCheck(const FieldOpponent *model);
+
+/** FieldOpponentLearn(*model, *oppField, *state)
+ *
+ * Adds the sunk boats of a finished game to the model.
+ *
+ * @param   *model      The model.
+ * @param   *oppField   The player's final view of the opponent's field.
+ * @param   *state      The AI state that played the game, for the squares
+ *                      that sank each boat; may be NULL.
+ * @return  The number of boats learned from.
+ */
+uint8_t FieldOpponentLearn(FieldOpponent *model, const Field *oppField,
+                           const FieldAIState *state);
+
+/** FieldOpponentScale(*model, placement)
+ *
+ * @param   *model      The model.
+ * @param   placement   An index into fieldPlacements.
+ * @return  The placement's prior scale, with FIELD_OPPONENT_SCALE_BITS
+ *          fractional bits; 1.0 is the average for its boat type.
+ */
+uint32_t FieldOpponentScale(const FieldOpponent *model, uint16_t placement);
+
+/** FieldOpponentDecideGuess(*model, *oppField)
+ *
+ * FieldDensityDecideGuess() with every placement weighted by the prior.
+ *
+ * @param   *model      The model; NULL scores like FieldDensityDecideGuess().
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldOpponentDecideGuess(const FieldOpponent *model, const Field *oppField);
+
+/** FieldOpponentSave(*model, *path)
+ *
+ * Writes the model to a file, setting its checksum first. Host only; on the
+ * Nucleo it returns STANDARD_ERROR.
+ *
+ * @param   *model  The model.
+ * @param   *path   The file to write.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentSave(FieldOpponent *model, const char *path);
+
+/** FieldOpponentLoad(*model, *path)
+ *
+ * Reads a model written by FieldOpponentSave(). Host only.
+ *
+ * @param   *model  Receives the model.
+ * @param   *path   The file to read.
+ * @return  SUCCESS, or STANDARD_ERROR if the file is missing or fails
+ *          FieldOpponentCheck().
+ */
+uint8_t FieldOpponentLoad(FieldOpponent *model, const char *path);
+
+/** FieldOpponentFlashSave(*model)
+ *
+ * Erases FIELD_OPPONENT_FLASH_SECTOR and writes the model to it. The CPU
+ * stalls while the sector is erased, which takes about a second on the
+ * F411, so only call this between games. Nothing is erased if the firmware
+ * image reaches FIELD_OPPONENT_FLASH_ADDRESS. Nucleo only; on the host it
+ * returns STANDARD_ERROR.
+ *
+ * @param   *model  The model.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentFlashSave(FieldOpponent *model);
+
+/** FieldOpponentFlashLoad(*model)
+ *
+ * Copies the model out of flash. Nucleo only.
+ *
+ * @param   *model  Receives the model.
+ * @return  SUCCESS, or STANDARD_ERROR if the sector holds no valid model.
+ */
+uint8_t FieldOpponentFlashLoad(FieldOpponent *model);
+
+
+#endif // FIELD_OPPONENT_H
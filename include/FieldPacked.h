@@ -0,0 +1,117 @@
+#ifndef FIELD_PACKED_H
+#define FIELD_PACKED_H
+/**
+ * @file    FieldPacked.h
+ *
+ * Compact storage for fields that are kept in bulk.
+ *
+ * A Field spends a byte per square, a byte per boat's lives and a word per
+ * bit plane. A FieldPacked keeps the same state in a nibble per square and a
+ * nibble per boat's lives: 32 bytes on the standard field, against
+ * sizeof(Field). Nothing else is stored: the planes and hash of a Field are
+ * rebuilt by FieldUnpack(). The boat table is not kept either: an unpacked
+ * field sinks its boats by type, which is only the same as the table with one
+ * boat of each type.
+ *
+ * Square i is nibble i of the words, counting from the low nibble of word 0.
+ * The lives of boat type t follow the squares, as nibble FIELD_NUM_SQUARES + t.
+ * A square's status is read or written with a shift and a mask, and
+ * FieldPackedGetBitboard() compares all sixteen nibbles of a word at once, so
+ * the common queries need no unpacking.
+ *
+ * FieldPack() therefore refuses a field with several boats of one type, which
+ * FieldUnpack() could not give back. Their lives may not fit a nibble anyway.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_PACKED_NIBBLES (FIELD_NUM_SQUARES + FIELD_NUM_BOATS)
+#define FIELD_PACKED_WORDS ((FIELD_PACKED_NIBBLES + 15) / 16)
+#define FIELD_PACKED_MAX_LIVES 15
+
+/** FieldPacked
+ *
+ * A Field's grid and boat lives, a nibble each.
+ */
+typedef struct {
+    uint64_t word[FIELD_PACKED_WORDS];
+} FieldPacked;
+
+
+/*  PROTOTYPES  */
+
+/** FieldPack(*packed, *f)
+ *
+ * @param   *packed The packed field to fill.
+ * @param   *f      The field to pack.
+ * @return  SUCCESS, or STANDARD_ERROR if a square or a boat's lives does not
+ *          fit in a nibble, or the boat table numbers more than one boat of a
+ *          type. *packed is filled either way.
+ */
+uint8_t FieldPack(FieldPacked *packed, const Field *f);
+
+/** FieldUnpack(*f, *packed)
+ *
+ * Restores a field, with its bit planes and hash. The boat table is left
+ * empty, which plays the same as the packed field's one boat per type.
+ *
+ * @param   *f      The field to fill.
+ * @param   *packed The packed field.
+ */
+void FieldUnpack(Field *f, const FieldPacked *packed);
+
+/** FieldPackedGetSquareStatus(*packed, row, col)
+ *
+ * FieldGetSquareStatus() for a packed field.
+ *
+ * @param   *packed The packed field.
+ * @param   row     The row-component of the location to retrieve
+ * @param   col     The column-component of the location to retrieve
+ * @return  FIELD_SQUARE_INVALID if row and col are not valid field locations
+ *          Otherwise, return the status of the referenced square.
+ */
+SquareStatus FieldPackedGetSquareStatus(const FieldPacked *packed, uint8_t row, uint8_t col);
+
+/** FieldPackedSetSquareStatus(*packed, row, col, p)
+ *
+ * FieldSetSquareStatus() for a packed field.
+ *
+ * @param   *packed The packed field.
+ * @param   row     The row-component of the location to modify.
+ * @param   col     The column-component of the location to modify.
+ * @param   p       The new value of the field location.
+ * @return  The old value at that field location, or FIELD_SQUARE_INVALID if
+ *          the location is not on the field.
+ */
+SquareStatus FieldPackedSetSquareStatus(FieldPacked *packed, uint8_t row, uint8_t col,
+                                        SquareStatus p);
+
+/** FieldPackedGetBoatStates(*packed)
+ *
+ * FieldGetBoatStates() for a packed field.
+ *
+ * @param   *packed The packed field.
+ * @return  A 4-bit value with each bit corresponding to whether each ship is
+ *          alive or not.
+ */
+uint8_t FieldPackedGetBoatStates(const FieldPacked *packed);
+
+/** FieldPackedGetBitboard(*packed, p)
+ *
+ * FieldGetBitboard() for a packed field, computed from the nibbles. Unlike
+ * FieldGetBitboard(), it also finds FIELD_SQUARE_CURSOR squares.
+ *
+ * @param   *packed The packed field.
+ * @param   p       The status to look up.
+ * @return  A bitboard of all squares with status p.
+ */
+FieldBitboard FieldPackedGetBitboard(const FieldPacked *packed, SquareStatus p);
+
+
+#endif // FIELD_PACKED_H
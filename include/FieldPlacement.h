@@ -0,0 +1,92 @@
+#ifndef FIELD_PLACEMENT_H
+#define FIELD_PLACEMENT_H
+/**
+ * @file    FieldPlacement.h
+ *
+ * Constant tables of every legal boat placement on a FIELD_ROWS x FIELD_COLS
+ * field, stored as FieldBitboard masks. The tables are written to
+ * src/FieldPlacementTable.c by tools/FieldPlacementGen.c (see the
+ * GNUmakefile), so they are plain const data and end up in flash on the
+ * Nucleo.
+ *
+ * With the tables, checking whether a boat fits is a lookup plus a mask test,
+ * and enumerating every placement of a boat is a walk over a const array.
+ * The hunt lattices let FieldAIStateDecideGuess() pick a hunting square with
+ * a mask and a bit scan.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * The number of starting positions for a boat of length `size` along an axis
+ * of length `n`, and the number of placements (both directions) on the field.
+ */
+#define FIELD_PLACEMENT_SPAN(n, size) ((n) >= (size) ? (n) - (size) + 1 : 0)
+#define FIELD_PLACEMENTS_OF_SIZE(size) \
+        (FIELD_ROWS * FIELD_PLACEMENT_SPAN(FIELD_COLS, size) + \
+         FIELD_PLACEMENT_SPAN(FIELD_ROWS, size) * FIELD_COLS)
+
+/**
+ * The widest hunt lattice, set by the longest boat.
+ */
+#define FIELD_HUNT_MAX_SPACING FIELD_BOAT_SIZE_HUGE
+
+/**
+ * The total number of placements of all four boat types.
+ */
+#define FIELD_NUM_PLACEMENTS \
+        (FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_SMALL) + \
+         FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_MEDIUM) + \
+         FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_LARGE) + \
+         FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_HUGE))
+
+/** FieldPlacement
+ *
+ * One legal position of one boat. `mask` holds the squares the boat covers.
+ */
+typedef struct {
+    FieldBitboard mask;
+    uint8_t row;
+    uint8_t col;
+    uint8_t dir;    // BoatDirection
+    uint8_t type;   // BoatType
+} FieldPlacement;
+
+
+/*  TABLES  */
+
+/**
+ * Boat lengths, indexed by BoatType.
+ */
+extern const uint8_t fieldBoatSizes[FIELD_NUM_BOATS];
+
+/**
+ * Every legal placement, grouped by BoatType. The placements of type t are
+ * fieldPlacements[fieldPlacementFirst[t]] up to (but not including)
+ * fieldPlacements[fieldPlacementFirst[t + 1]].
+ */
+extern const FieldPlacement fieldPlacements[FIELD_NUM_PLACEMENTS];
+extern const uint16_t fieldPlacementFirst[FIELD_NUM_BOATS + 1];
+
+/**
+ * Placement masks indexed by [BoatType][row][col][BoatDirection]. An entry is
+ * 0 when the boat would leave the field.
+ */
+extern const FieldBitboard fieldPlacementMasks[FIELD_NUM_BOATS][FIELD_ROWS][FIELD_COLS][2];
+
+/**
+ * Hunt lattices indexed by [BoatType][offset]: the squares where
+ * (row + col) % fieldBoatSizes[type] == offset. Every placement of a boat at
+ * least that long covers one square of each. Offsets from the boat's length
+ * up are 0.
+ */
+extern const FieldBitboard fieldHuntLattices[FIELD_NUM_BOATS][FIELD_HUNT_MAX_SPACING];
+
+
+#endif // FIELD_PLACEMENT_H
@@ -0,0 +1,168 @@
+#ifndef FIELD_POLICY_H
+#define FIELD_POLICY_H
+/**
+ * @file    FieldPolicy.h
+ *
+ * AI strategies chosen by name at run time.
+ *
+ * A FieldPolicy is a table of five functions:
+ *   - place() sets out the fleet,
+ *   - decide() picks a shot,
+ *   - observe() takes the result of that shot,
+ *   - reset() starts a new game,
+ *   - finish() looks back over a game that has ended; it may be NULL.
+ * Each one works on a FieldPolicyState. That state holds the policy's memory
+ * for one game, so any number of policies and games can run in one binary.
+ *
+ * The built-in policies are registered from the start. Other code can add its
+ * own with FieldPolicyRegister(), then look any of them up with
+ * FieldPolicyFind(). The Agent plays FIELD_POLICY_AGENT_DEFAULT unless
+ * AgentSetPolicy() picks another one; bb_sim takes policy names on its command
+ * line.
+ *
+ * Built-in policies, all placing with FieldAIPlaceAllBoats() unless noted:
+ *   stock      FieldAIStateDecideGuess()
+ *   density    FieldDensityDecideGuess()
+ *   map        a FieldDensityMap kept up to date across turns
+ *   sampler    FieldSamplerRun() with the state's samples and budget
+ *   exact      the opening book, then the cache, then FieldExactSolve(); it
+ *              takes milliseconds per shot (host only)
+ *   anytime    FieldAIDecideGuessWithin() with the state's deadline, which
+ *              starts from the opening book
+ *   uniform    stock hunting, FieldAIPlaceAllBoatsUniform() placement
+ *   tuned      stock hunting, FieldAIPlaceAllBoatsTuned() placement
+ *   entropy    FieldEntropyBestGuess(), from the cache or exact when quick
+ *              enough, otherwise sampled with the state's samples and budget
+ *              (host only)
+ *   model      FieldOpponentDecideGuess() with the FieldOpponent behind user,
+ *              which finish() teaches and, on the Nucleo, saves to flash;
+ *              plain density while user is NULL
+ * Host-only policies are left out of STM32F4 builds, along with the modules
+ * behind them; "anytime" is the board's way to use the exact solver.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldCache.h"
+#include "FieldDensity.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * Room in the registry, built-in policies included.
+ */
+#define FIELD_POLICY_MAX 16
+
+/**
+ * The policy the Agent plays until told otherwise.
+ */
+#define FIELD_POLICY_AGENT_DEFAULT "tuned"
+
+/**
+ * The built-in policy that plays from the FieldOpponent behind user. Other
+ * policies are free to use user for their own memory.
+ */
+#define FIELD_POLICY_MODEL "model"
+
+/**
+ * The default time a policy may spend on one shot. It matches the sampler's
+ * budget: 8 ms of the 10 ms Transmission tick on the Nucleo.
+ */
+#ifndef FIELD_POLICY_DEFAULT_DEADLINE_US
+#define FIELD_POLICY_DEFAULT_DEADLINE_US 8000
+#endif
+
+/** FieldPolicyState
+ *
+ * One game's memory for one policy. Built-in policies use the members they
+ * need. A registered policy can keep its own memory behind user.
+ * samples, budgetMicros and deadlineMicros are set by FieldPolicyStateInit()
+ * and may be changed before reset().
+ *
+ * cache is NULL unless the caller sets it. The "exact" and "entropy" policies
+ * then look up each field there before analysing it and store what they work
+ * out, counting both in cacheStats. Several states, on several threads, may
+ * share one cache. Nothing uses it in STM32F4 builds.
+ */
+typedef struct {
+    FieldAIState ai;
+    FieldDensityMap map;
+    FieldSampler sampler;
+    Rng rng;
+    uint32_t samples;           // Samples per shot for "sampler"
+    uint32_t budgetMicros;      // Time per shot for "sampler", or 0
+    uint32_t deadlineMicros;    // Time per shot for "anytime"
+    FieldCache *cache;          // Shared analyses, or NULL
+    FieldCacheStats cacheStats;
+    void *user;
+} FieldPolicyState;
+
+/** FieldPolicy
+ *
+ * A strategy. name is how it is looked up; description is one line for
+ * listings. place() and decide() follow FieldAIPlaceAllBoats() and
+ * FieldAIDecideGuess(). observe() is called after FieldUpdateKnowledge() with
+ * the same shot. reset() is called with a fresh opponent field before each
+ * game. finish(), if set, is called once a game is won or lost, with the final
+ * opponent field.
+ */
+typedef struct {
+    const char *name;
+    const char *description;
+    uint8_t (*place)(FieldPolicyState *state, Field *ownField);
+    GuessData (*decide)(FieldPolicyState *state, const Field *oppField);
+    void (*observe)(FieldPolicyState *state, const Field *oppField, const GuessData *ownGuess);
+    void (*reset)(FieldPolicyState *state, const Field *oppField);
+    void (*finish)(FieldPolicyState *state, const Field *oppField);
+} FieldPolicy;
+
+
+/*  PROTOTYPES  */
+
+/** FieldPolicyStateInit(*state, *rng)
+ *
+ * Sets the default limits and seeds the state's own generator from *rng.
+ * Call the policy's reset() before the first game.
+ *
+ * @param   *state  The state.
+ * @param   *rng    The generator to seed from.
+ */
+void FieldPolicyStateInit(FieldPolicyState *state, Rng *rng);
+
+/** FieldPolicyFind(*name)
+ *
+ * @param   *name   A policy name.
+ * @return  The registered policy with that name, or NULL.
+ */
+const FieldPolicy *FieldPolicyFind(const char *name);
+
+/** FieldPolicyRegister(*policy)
+ *
+ * Adds a policy to the registry. The policy must outlive every lookup.
+ *
+ * @param   *policy The policy, with every function but finish() set.
+ * @return  SUCCESS, or STANDARD_ERROR if the name is taken, a function is
+ *          missing or the registry is full.
+ */
+uint8_t FieldPolicyRegister(const FieldPolicy *policy);
+
+/** FieldPolicyCount()
+ *
+ * @return  The number of registered policies.
+ */
+uint8_t FieldPolicyCount(void);
+
+/** FieldPolicyGet(index)
+ *
+ * @param   index   0 to FieldPolicyCount() - 1, in registration order.
+ * @return  The policy, or NULL if index is out of range.
+ */
+const FieldPolicy *FieldPolicyGet(uint8_t index);
+
+
+#endif // FIELD_POLICY_H
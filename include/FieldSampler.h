@@ -0,0 +1,203 @@
+#ifndef FIELD_SAMPLER_H
+#define FIELD_SAMPLER_H
+/**
+ * @file    FieldSampler.h
+ *
+ * Monte Carlo sampler over the opponent's field. It draws random full-fleet
+ * configurations that agree with everything FieldUpdateKnowledge() has
+ * recorded, and tallies how often each square is covered by a boat. The
+ * tallies estimate the posterior hit probability of every square.
+ *
+ * A configuration places all four boats without overlap such that:
+ *   - no boat covers a FIELD_SQUARE_MISS,
+ *   - every FIELD_SQUARE_HIT is covered by some boat,
+ *   - a sunk boat (zero lives) lies entirely on hit squares,
+ *   - a live boat covers at least one square that has not been hit.
+ *
+ * Each boat is drawn uniformly from its own legal placements and the whole
+ * draw is rejected if the constraints fail. The accepted samples are therefore
+ * exactly uniform over the consistent configurations.
+ *
+ * Sampling stops at a caller-supplied sample count or a microsecond budget,
+ * whichever comes first.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * On the Nucleo, AgentRun() has to return its SHO message within one
+ * Transmission tick. Lab10_main_ec.c runs that every TRANSMIT_PERIOD ticks of
+ * 1/100 s. The default budget stops sampling after 8 ms of that 10 ms.
+ * On a host there is no deadline, so the default is a fixed sample count.
+ * Either can be overridden at compile time.
+ */
+#ifndef FIELD_SAMPLER_DEFAULT_BUDGET_US
+#ifdef STM32F4
+#define FIELD_SAMPLER_DEFAULT_BUDGET_US 8000
+#else
+#define FIELD_SAMPLER_DEFAULT_BUDGET_US 0
+#endif
+#endif
+#ifndef FIELD_SAMPLER_DEFAULT_SAMPLES
+#ifdef STM32F4
+#define FIELD_SAMPLER_DEFAULT_SAMPLES 0
+#else
+#define FIELD_SAMPLER_DEFAULT_SAMPLES 20000
+#endif
+#endif
+
+/**
+ * When only a sample count is given, stop after this many draws per requested
+ * sample. This only matters on inconsistent fields, where no draw can ever be
+ * accepted.
+ */
+#define FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE 256
+
+/**
+ * The small boat has the most placements, so it bounds every candidate list.
+ */
+#define FIELD_SAMPLER_MAX_CANDIDATES FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_SMALL)
+
+/** FieldSamplerCandidates
+ *
+ * The placements each boat may take on the current field, after removing
+ * everything that contradicts a miss or the boat's sunk/alive state. Entries
+ * index fieldPlacements[] so that the lists stay small enough for the Nucleo's
+ * stack. Built once per decision and shared read-only by every sampling loop.
+ */
+typedef struct {
+    uint16_t index[FIELD_NUM_BOATS][FIELD_SAMPLER_MAX_CANDIDATES];
+    uint8_t count[FIELD_NUM_BOATS];
+    FieldBitboard hits;
+    FieldBitboard unknown;
+} FieldSamplerCandidates;
+
+/** FieldSampler
+ *
+ * Tallies and random state for one sampling run. The RNG state is part of the
+ * struct so that independent samplers never share state.
+ */
+typedef struct {
+    uint32_t tally[FIELD_NUM_SQUARES];  // Accepted samples covering each square
+    uint32_t samples;                   // Accepted samples
+    uint32_t attempts;                  // Draws, including rejected ones
+    uint64_t rng;                       // xorshift64* state, never 0
+} FieldSampler;
+
+
+/*  PROTOTYPES  */
+
+/** FieldSamplerInit(*sampler, seed)
+ *
+ * Clears the tallies and seeds the sampler's random state.
+ *
+ * @param   *sampler    The sampler to initialize.
+ * @param   seed        Any value; 0 is replaced by a fixed nonzero constant.
+ */
+void FieldSamplerInit(FieldSampler *sampler, uint64_t seed);
+
+/** FieldSamplerRun(*sampler, *oppField, maxSamples, budgetMicros)
+ *
+ * Clears the tallies and samples configurations consistent with oppField
+ * until maxSamples have been accepted or budgetMicros have elapsed. A limit of
+ * 0 means "no limit", but at least one of the two must be nonzero.
+ *
+ * @param   *sampler        The sampler to fill.
+ * @param   *oppField       The opponent's field.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldSamplerRun(FieldSampler *sampler, const Field *oppField,
+                         uint32_t maxSamples, uint32_t budgetMicros);
+
+/** FieldSamplerBestGuess(*sampler, *oppField)
+ *
+ * Picks the unknown square that was covered in the most samples. If nothing
+ * was accepted, falls back to FieldDensityDecideGuess().
+ *
+ * @param   *sampler    A sampler filled by FieldSamplerRun().
+ * @param   *oppField   The same field that was sampled.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldSamplerBestGuess(const FieldSampler *sampler, const Field *oppField);
+
+/** FieldSamplerDecideGuess(*oppField)
+ *
+ * Sampling replacement for FieldAIDecideGuess(). Runs a module-level sampler
+ * with FIELD_SAMPLER_DEFAULT_SAMPLES / FIELD_SAMPLER_DEFAULT_BUDGET_US and
+ * returns its best guess.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldSamplerDecideGuess(const Field *oppField);
+
+/** FieldSamplerPrepare(*oppField, *c)
+ *
+ * Builds the candidate placement lists for every boat.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *c          Output candidate lists.
+ * @return  0 if some boat has no legal placement at all, 1 otherwise.
+ */
+uint8_t FieldSamplerPrepare(const Field *oppField, FieldSamplerCandidates *c);
+
+/** FieldSamplerDraw(*rng, *c)
+ *
+ * Makes one draw: each boat is picked uniformly from its candidates, and the
+ * draw is rejected on overlap or if a hit is left uncovered.
+ *
+ * @param   *rng    xorshift64* state to draw from.
+ * @param   *c      Candidate lists from FieldSamplerPrepare().
+ * @return  The squares covered by the fleet, or 0 if the draw was rejected.
+ */
+FieldBitboard FieldSamplerDraw(uint64_t *rng, const FieldSamplerCandidates *c);
+
+/** FieldSamplerDrawBoats(*rng, *c, placement)
+ *
+ * FieldSamplerDraw() that also reports where each boat went, for callers that
+ * tally more than coverage. The draws are the same as FieldSamplerDraw()'s
+ * for the same RNG state.
+ *
+ * @param   *rng        xorshift64* state to draw from.
+ * @param   *c          Candidate lists from FieldSamplerPrepare().
+ * @param   placement   If not NULL, receives an index into fieldPlacements per
+ *                      BoatType; only meaningful if the draw was accepted.
+ * @return  The squares covered by the fleet, or 0 if the draw was rejected.
+ */
+FieldBitboard FieldSamplerDrawBoats(uint64_t *rng, const FieldSamplerCandidates *c,
+                                    uint16_t placement[FIELD_NUM_BOATS]);
+
+/** FieldSamplerSeed(seed, stream)
+ *
+ * Derives an independent RNG state for one stream of a seed, e.g. one per
+ * worker thread.
+ *
+ * @param   seed    The base seed.
+ * @param   stream  The stream number.
+ * @return  A nonzero RNG state.
+ */
+uint64_t FieldSamplerSeed(uint64_t seed, uint32_t stream);
+
+/** FieldSamplerMicros()
+ *
+ * The microsecond clock used for sampling budgets. This is FieldAIMicros(),
+ * kept under its own name for existing callers. It wraps about every 71
+ * minutes, so compare times by subtraction only.
+ *
+ * @return  The current time in microseconds.
+ */
+uint32_t FieldSamplerMicros(void);
+
+
+#endif // FIELD_SAMPLER_H
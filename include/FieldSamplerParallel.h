@@ -0,0 +1,67 @@
+#ifndef FIELD_SAMPLER_PARALLEL_H
+#define FIELD_SAMPLER_PARALLEL_H
+/**
+ * @file    FieldSamplerParallel.h
+ *
+ * Host-only multi-threaded backend for the Monte Carlo sampler. Each worker
+ * thread has its own RNG stream and tally array, so the sampling loop never
+ * takes a lock or touches shared memory. The tallies are merged once all
+ * workers finish.
+ *
+ * The requested sample count is cut into fixed-size chunks, and each worker
+ * starts with an equal share of them. A worker that finishes its share steals
+ * half of the remaining chunks from a busier worker. Late-game states, where
+ * most draws are rejected and chunks take very different amounts of time, can
+ * therefore still keep every core busy.
+ *
+ * Requires POSIX threads; link with -pthread. Not part of the Nucleo build.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldSampler.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * Accepted samples per unit of stealable work. Small enough to balance load,
+ * large enough that claiming a chunk is rare compared to drawing.
+ */
+#define FIELD_SAMPLER_CHUNK 1024
+
+/**
+ * Upper bound on worker threads for one run.
+ */
+#define FIELD_SAMPLER_MAX_THREADS 256
+
+
+/*  PROTOTYPES  */
+
+/** FieldSamplerRunParallel(*sampler, *oppField, maxSamples, budgetMicros, threads)
+ *
+ * Parallel version of FieldSamplerRun(). The merged tallies, sample and
+ * attempt counts are stored in *sampler exactly as FieldSamplerRun() would
+ * store them. Worker i draws from FieldSamplerSeed(sampler->rng, i), and
+ * sampler->rng is advanced afterwards so that consecutive runs differ.
+ *
+ * With a sample count, the run stops once exactly that many samples have been
+ * accepted. With only a budget, every worker samples until the budget has
+ * elapsed.
+ *
+ * @param   *sampler        Receives the merged results.
+ * @param   *oppField       The opponent's field.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @param   threads         Worker threads to use, 1 to
+ *                          FIELD_SAMPLER_MAX_THREADS.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldSamplerRunParallel(FieldSampler *sampler, const Field *oppField,
+                                 uint32_t maxSamples, uint32_t budgetMicros,
+                                 uint16_t threads);
+
+
+#endif // FIELD_SAMPLER_PARALLEL_H
@@ -0,0 +1,99 @@
+#ifndef RNG_H
+#define RNG_H
+/**
+ * @file    Rng.h
+ *
+ * Random numbers for the game. Every random decision takes an Rng, so each
+ * game, thread or test can own its generator and replay it from a seed.
+ *
+ * The generator is xoshiro256**: 256 bits of state, a period of 2^256 - 1
+ * and a few nanoseconds per draw, with no global state and no locking.
+ * RngSplit() hands out non-overlapping streams by jumping 2^128 draws ahead,
+ * so parallel workers can be split off one seed and still be reproduced.
+ *
+ * RngDefault() is the generator behind the functions that predate Rng, such
+ * as FieldAIPlaceAllBoats(). On the Nucleo, Lab10_main_ec.c stirs timer
+ * readings into it with RngMix() whenever a user event happens.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/** Rng
+ *
+ * One generator. Initialize with RngSeed() or RngSplit(); an all-zero state
+ * never changes.
+ */
+typedef struct {
+    uint64_t s[4];
+} Rng;
+
+
+/*  PROTOTYPES  */
+
+/** RngSeed(*rng, seed)
+ *
+ * Expands a 64-bit seed into a full state with splitmix64. Equal seeds give
+ * equal sequences.
+ *
+ * @param   *rng    The generator.
+ * @param   seed    Any value.
+ */
+void RngSeed(Rng *rng, uint64_t seed);
+
+/** RngNext(*rng)
+ *
+ * @param   *rng    The generator.
+ * @return  64 random bits.
+ */
+uint64_t RngNext(Rng *rng);
+
+/** RngBelow(*rng, bound)
+ *
+ * Draws uniformly from [0, bound) without modulo bias.
+ *
+ * @param   *rng    The generator.
+ * @param   bound   The number of outcomes.
+ * @return  The draw, or 0 if bound is 0.
+ */
+uint32_t RngBelow(Rng *rng, uint32_t bound);
+
+/** RngJump(*rng)
+ *
+ * Advances the generator by 2^128 draws.
+ *
+ * @param   *rng    The generator.
+ */
+void RngJump(Rng *rng);
+
+/** RngSplit(*rng, *stream)
+ *
+ * Copies the current stream into *stream and jumps *rng past it. Splitting
+ * N times gives N streams of 2^128 draws that cannot overlap.
+ *
+ * @param   *rng    The parent generator.
+ * @param   *stream Receives the new stream.
+ */
+void RngSplit(Rng *rng, Rng *stream);
+
+/** RngMix(*rng, entropy)
+ *
+ * Stirs outside entropy, such as a timer reading, into the state. The
+ * sequence depends on every value mixed in and on the order they came in.
+ *
+ * @param   *rng    The generator.
+ * @param   entropy Any value.
+ */
+void RngMix(Rng *rng, uint64_t entropy);
+
+/** RngDefault()
+ *
+ * @return  The generator used where no Rng is passed.
+ */
+Rng *RngDefault(void);
+
+
+#endif // RNG_H
@@ -21,8 +21,11 @@
  #include "BattleBoats.h"
  #include "FieldOled.h"
  #include "Field.h"
+ #include "FieldOpponent.h"
+ #include "FieldPolicy.h"
  #include "Negotiation.h"
  #include "Oled.h"
+ #include "Rng.h"
  #include <string.h>
  #include <stdbool.h>
  
@@ -51,6 +54,15 @@
  static NegotiationOutcome turn_order;
  static bool endScreenDrawn = false;
  
+ // The AI strategy and its memory for the current game
+ static const FieldPolicy *agentPolicy = NULL;
+ static FieldPolicyState agentPolicyState;
+ 
+ // What the AI has learned about its opponents, kept in flash between power-ups.
+ // One model serves every opponent: nothing in the protocol says who they are.
+ static FieldOpponent agentOpponent;
+ static bool agentOpponentLoaded = false;
+ 
  // Draws a single field (unused internal helper)
  void _FieldOledDrawField(const Field *f, int xOffset);
  
@@ -63,6 +75,29 @@
      playerTurn = FIELD_OLED_TURN_NONE;
      endScreenDrawn = false;
      FieldInit(&ownField, &oppField);
+ 
+     if (agentPolicy == NULL) {
+         agentPolicy = FieldPolicyFind(FIELD_POLICY_AGENT_DEFAULT);
+     }
+     FieldPolicyStateInit(&agentPolicyState, RngDefault());
+     if (strcmp(agentPolicy->name, FIELD_POLICY_MODEL) == 0) {
+         // Only the model policy plays from agentOpponent; others own user
+         if (!agentOpponentLoaded) {
+             if (FieldOpponentFlashLoad(&agentOpponent) != SUCCESS) {
+                 FieldOpponentInit(&agentOpponent, 0);
+             }
+             agentOpponentLoaded = true;
+         }
+         agentPolicyState.user = &agentOpponent;
+     }
+     agentPolicy->reset(&agentPolicyState, &oppField);
+ }
+ 
+ // Lets the policy look back over a finished game
+ static void AgentFinishGame(void) {
+     if (agentPolicy->finish != NULL) {
+         agentPolicy->finish(&agentPolicyState, &oppField);
+     }
  }
  
  // Main function to run the Agent logic based on event input
@@ -90,13 +125,13 @@
  
              // If challenge initiated
              if (event.type == BB_EVENT_START_BUTTON) {
-                 A = rand() % 65536;
+                 A = RngBelow(RngDefault(), 65536);
                  hashA = NegotiationHash(A);
                  messageToSend.type = MESSAGE_CHA;
                  messageToSend.param0 = hashA;
  
                  // Place boats and transition to CHALLENGING
-                 if (FieldAIPlaceAllBoats(&ownField) == SUCCESS) {
+                 if (agentPolicy->place(&agentPolicyState, &ownField) == SUCCESS) {
                      agentState = AGENT_STATE_CHALLENGING;
                      OLED_Clear(OLED_COLOR_BLACK);
                      char buf[96];
@@ -112,12 +147,12 @@
              // If opponent's challenge received
              } else if (event.type == BB_EVENT_CHA_RECEIVED) {
                  hashA = event.param0;
-                 B = rand() % 65536;
+                 B = RngBelow(RngDefault(), 65536);
                  messageToSend.type = MESSAGE_ACC;
                  messageToSend.param0 = B;
  
                  // Place boats and transition to ACCEPTING
-                 if (FieldAIPlaceAllBoats(&ownField) == SUCCESS) {
+                 if (agentPolicy->place(&agentPolicyState, &ownField) == SUCCESS) {
                      agentState = AGENT_STATE_ACCEPTING;
                      printf("START -> ACCEPTING\n");
                      OLED_Clear(OLED_COLOR_BLACK);
@@ -174,7 +209,7 @@
                  // Verification successful -> determine turn
                  } else {
                      turn_order = NegotiateCoinFlip(event.param1, B);
-                     own_guess = FieldAIDecideGuess(&oppField);
+                     own_guess = agentPolicy->decide(&agentPolicyState, &oppField);
                      messageToSend.type = MESSAGE_SHO;
                      messageToSend.param0 = own_guess.row;
                      messageToSend.param1 = own_guess.col;
@@ -203,6 +238,7 @@
              if (event.type == BB_EVENT_RES_RECEIVED) {
                  own_guess.result = event.param2;
                  FieldUpdateKnowledge(&oppField, &own_guess);
+                 agentPolicy->observe(&agentPolicyState, &oppField, &own_guess);
                  uint8_t oppState = FieldGetBoatStates(&oppField);
                  printf("DEBUG: Opponent boat state after update = %u\n", oppState);
  
@@ -255,7 +291,7 @@
          case AGENT_STATE_WAITING_TO_SEND:
              if (event.type == BB_EVENT_MESSAGE_SENT) {
                  turn_counter++;
-                 own_guess = FieldAIDecideGuess(&oppField);
+                 own_guess = agentPolicy->decide(&agentPolicyState, &oppField);
                  messageToSend.type = MESSAGE_SHO;
                  messageToSend.param0 = own_guess.row;
                  messageToSend.param1 = own_guess.col;
@@ -288,6 +324,9 @@
                  }
  
                  OLED_Update();
+                 if (oppState == 0 || ownState == 0) {
+                     AgentFinishGame();
+                 }
                  endScreenDrawn = true;
              }
              break;
@@ -306,4 +345,14 @@
  void AgentSetState(AgentState newState) {
      agentState = newState;
  }
+ 
+ // Picks the AI strategy by name; used from the next AgentInit()
+ uint8_t AgentSetPolicy(const char *name) {
+     const FieldPolicy *policy = FieldPolicyFind(name);
+     if (policy == NULL) {
+         return STANDARD_ERROR;
+     }
+     agentPolicy = policy;
+     return SUCCESS;
+ }
  
\ No newline at end of file
@@ -0,0 +1,548 @@
+/**
+ * @file    BattleBoatsSim.c
+ *
+ * Headless self-play simulator. Plays complete games between two policies
+ * without a Nucleo or an OLED, spread over every core. Each game goes through
+ * the same three phases as Agent.c:
+ *   - negotiation: the challenger commits to A with NegotiationHash(), the
+ *     acceptor answers with B, the challenger reveals A and the acceptor
+ *     checks it with NegotiationVerify(). NegotiateCoinFlip() then picks who
+ *     shoots first, HEADS meaning the challenger.
+ *   - placement: each side places its fleet.
+ *   - play: the two sides take turns until one fleet is sunk.
+ * The two policies swap the challenger role every game.
+ *
+ * A side is given as policy[/placer], naming policies from the FieldPolicy
+ * registry (see FieldPolicy.h). The first one hunts. The placer, if given,
+ * sets out the fleet instead of the hunter, so "density/tuned" hunts by
+ * density from behind the tuned layouts. -S sets the sampler's samples per
+ * shot and -D the anytime policy's deadline per shot in microseconds. A
+ * policy that learns, such as "model", keeps one FieldOpponent per side and
+ * thread, so it adapts to the other side over the run. -C gives both sides on
+ * every thread one shared FieldCache of that many entries, and the report
+ * gives each side's hit rate, to size it by.
+ *
+ * The report gives each policy's win rate, the shots the winner needed, games
+ * per second and the time spent in each phase. Every game's phases are timed.
+ * Timing every shot would cost as much as the cheaper hunters themselves, so
+ * the time per decision is measured on one game in SIM_TIMED_EVERY.
+ *
+ * Each worker draws from its own stream, split off the seed with RngSplit(),
+ * so a run is reproduced exactly by the same seed and thread count. Only the
+ * anytime hunter, which stops on a clock, can vary between runs.
+ *
+ * @usage   `$ ./bb_sim [-n games] [-a policy] [-b policy] [-j threads] [-s seed]
+ *                      [-S samples] [-D micros] [-C entries]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCache.h"
+#include "FieldOpponent.h"
+#include "FieldPolicy.h"
+#include "Negotiation.h"
+#include "Rng.h"
+
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define DEFAULT_GAMES 100000
+#define DEFAULT_SAMPLES 1000
+#define DEFAULT_DEADLINE_US 1000
+#define MAX_THREADS 256
+
+// Decisions are timed on one game in this many
+#define SIM_TIMED_EVERY 16
+
+// A side that has fired at every square without winning has a broken hunter
+#define SIM_MAX_SHOTS FIELD_NUM_SQUARES
+
+typedef enum {
+    SIM_PHASE_NEGOTIATION,
+    SIM_PHASE_PLACEMENT,
+    SIM_PHASE_PLAY,
+    SIM_NUM_PHASES
+} SimPhase;
+
+/**
+ * A hunting policy and the policy that places its fleet.
+ */
+typedef struct {
+    const FieldPolicy *hunter;
+    const FieldPolicy *placer;
+    char name[40];
+} SimPolicy;
+
+/**
+ * One side of a game: its boards, its policy's memory and what it has
+ * learned about the other side over the worker's games.
+ */
+typedef struct {
+    const SimPolicy *policy;
+    Field own;
+    Field opp;
+    FieldPolicyState state;
+    FieldOpponent model;
+} SimPlayer;
+
+/**
+ * Totals for a run, kept per thread and added up at the end. Index 0 is
+ * policy A and index 1 is policy B.
+ */
+typedef struct {
+    uint64_t games;
+    uint64_t wins[2];
+    uint64_t winsFirst[2];          // Wins when shooting first
+    uint64_t movedFirst[2];
+    uint64_t draws;
+    uint64_t badCommitments;        // Failed NegotiationVerify() checks
+    uint64_t winShots[2];           // Shots fired by the winner, per winner
+    uint64_t shotHist[SIM_MAX_SHOTS + 1];
+    uint64_t phaseNanos[SIM_NUM_PHASES];
+    uint64_t decideNanos[2];        // Over timed games only
+    uint64_t decideShots[2];
+    uint64_t cacheLookups[2];
+    uint64_t cacheHits[2];
+    uint64_t cacheStores[2];
+    uint64_t cacheEvictions[2];
+} SimStats;
+
+typedef struct {
+    const SimPolicy *policy[2];
+    uint64_t firstGame;
+    uint64_t games;
+    Rng rng;
+    SimStats stats;
+} SimWorker;
+
+static const char *phaseNames[SIM_NUM_PHASES] = {
+    "negotiation", "placement", "play"
+};
+
+static uint32_t samplesPerShot = DEFAULT_SAMPLES;
+static uint32_t deadlineMicros = DEFAULT_DEADLINE_US;
+static FieldCache cache;
+static FieldCache *sharedCache = NULL;
+
+
+/*  PRIVATE FUNCTIONS   */
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * Parses policy[/placer] into *policy.
+ *
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+static uint8_t ParsePolicy(const char *text, SimPolicy *policy)
+{
+    char hunter[sizeof(policy->name)];
+    const char *slash = strchr(text, '/');
+    size_t length = slash ? (size_t)(slash - text) : strlen(text);
+
+    if (length >= sizeof(hunter))
+    {
+        return STANDARD_ERROR;
+    }
+    memcpy(hunter, text, length);
+    hunter[length] = '\0';
+    policy->hunter = FieldPolicyFind(hunter);
+    policy->placer = slash ? FieldPolicyFind(slash + 1) : policy->hunter;
+    if (policy->hunter == NULL || policy->placer == NULL)
+    {
+        return STANDARD_ERROR;
+    }
+    if (policy->placer == policy->hunter)
+    {
+        snprintf(policy->name, sizeof(policy->name), "%s", policy->hunter->name);
+    }
+    else
+    {
+        snprintf(policy->name, sizeof(policy->name), "%s/%s",
+                 policy->hunter->name, policy->placer->name);
+    }
+    return SUCCESS;
+}
+
+/**
+ * Plays one game. player[challenger] takes the challenger role in the
+ * negotiation. Decisions are timed only if `timed` is nonzero.
+ */
+static void PlayGame(SimPlayer player[2], uint8_t challenger, uint8_t timed,
+                     Rng *rng, SimStats *stats)
+{
+    uint64_t start = NowNanos();
+
+    // Negotiation
+    NegotiationData secretA = (NegotiationData)RngBelow(rng, 65536);
+    NegotiationData commitment = NegotiationHash(secretA);
+    NegotiationData secretB = (NegotiationData)RngBelow(rng, 65536);
+    if (!NegotiationVerify(secretA, commitment))
+    {
+        stats->badCommitments++;
+    }
+    uint8_t turn = (NegotiateCoinFlip(secretA, secretB) == HEADS) ? challenger : !challenger;
+    uint8_t first = turn;
+    uint64_t negotiated = NowNanos();
+
+    // Placement
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        const SimPolicy *policy = player[i].policy;
+        FieldInit(&player[i].own, &player[i].opp);
+        policy->hunter->reset(&player[i].state, &player[i].opp);
+        policy->placer->place(&player[i].state, &player[i].own);
+    }
+    uint64_t placed = NowNanos();
+
+    // Play
+    uint8_t shots[2] = {0, 0};
+    uint8_t winner = 2;
+    while (shots[0] < SIM_MAX_SHOTS || shots[1] < SIM_MAX_SHOTS)
+    {
+        SimPlayer *attacker = &player[turn];
+        SimPlayer *defender = &player[!turn];
+        GuessData guess;
+        if (timed)
+        {
+            uint64_t before = NowNanos();
+            guess = attacker->policy->hunter->decide(&attacker->state, &attacker->opp);
+            stats->decideNanos[turn] += NowNanos() - before;
+            stats->decideShots[turn]++;
+        }
+        else
+        {
+            guess = attacker->policy->hunter->decide(&attacker->state, &attacker->opp);
+        }
+        FieldRegisterEnemyAttack(&defender->own, &guess);
+        FieldUpdateKnowledge(&attacker->opp, &guess);
+        attacker->policy->hunter->observe(&attacker->state, &attacker->opp, &guess);
+        shots[turn]++;
+        if (!FieldGetBoatStates(&defender->own))
+        {
+            winner = turn;
+            break;
+        }
+        turn = !turn;
+    }
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (player[i].policy->hunter->finish != NULL)
+        {
+            player[i].policy->hunter->finish(&player[i].state, &player[i].opp);
+        }
+    }
+    uint64_t end = NowNanos();
+
+    stats->games++;
+    stats->movedFirst[first]++;
+    if (winner < 2)
+    {
+        stats->wins[winner]++;
+        stats->winsFirst[winner] += (winner == first);
+        stats->winShots[winner] += shots[winner];
+        stats->shotHist[shots[winner]]++;
+    }
+    else
+    {
+        stats->draws++;
+    }
+    stats->phaseNanos[SIM_PHASE_NEGOTIATION] += negotiated - start;
+    stats->phaseNanos[SIM_PHASE_PLACEMENT] += placed - negotiated;
+    stats->phaseNanos[SIM_PHASE_PLAY] += end - placed;
+}
+
+static void *Work(void *arg)
+{
+    SimWorker *worker = arg;
+    SimPlayer player[2];
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        player[i].policy = worker->policy[i];
+        FieldPolicyStateInit(&player[i].state, &worker->rng);
+        player[i].state.samples = samplesPerShot;
+        player[i].state.budgetMicros = 0;
+        player[i].state.deadlineMicros = deadlineMicros;
+        player[i].state.cache = sharedCache;
+        FieldOpponentInit(&player[i].model, !i);
+        player[i].state.user = &player[i].model;
+    }
+    for (uint64_t g = worker->firstGame; g < worker->firstGame + worker->games; g++)
+    {
+        PlayGame(player, (uint8_t)(g & 1), (g % SIM_TIMED_EVERY) == 0, &worker->rng,
+                 &worker->stats);
+    }
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        const FieldCacheStats *c = &player[i].state.cacheStats;
+        worker->stats.cacheLookups[i] += c->lookups;
+        worker->stats.cacheHits[i] += c->hits;
+        worker->stats.cacheStores[i] += c->stores;
+        worker->stats.cacheEvictions[i] += c->evictions;
+    }
+    return NULL;
+}
+
+static void AddStats(SimStats *total, const SimStats *s)
+{
+    uint64_t *dst = (uint64_t *)total;
+    const uint64_t *src = (const uint64_t *)s;
+    for (size_t i = 0; i < sizeof(SimStats) / sizeof(uint64_t); i++)
+    {
+        dst[i] += src[i];
+    }
+}
+
+/**
+ * Prints a rate and its 95% normal-approximation interval.
+ */
+static void PrintRate(const char *label, uint64_t hits, uint64_t trials)
+{
+    double p = trials ? (double)hits / trials : 0.0;
+    double half = trials ? 1.96 * sqrt(p * (1 - p) / trials) : 0.0;
+    printf("  %-30s %6.2f%% +/- %.2f%%  (%llu of %llu)\n", label, 100 * p, 100 * half,
+           (unsigned long long)hits, (unsigned long long)trials);
+}
+
+static void Report(const SimStats *s, const SimPolicy *policy[2], double seconds)
+{
+    char label[64];
+    uint64_t decided = s->wins[0] + s->wins[1];
+
+    printf("\nResults\n");
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        snprintf(label, sizeof(label), "%c %s wins", 'A' + i, policy[i]->name);
+        PrintRate(label, s->wins[i], s->games);
+    }
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        snprintf(label, sizeof(label), "%c wins when shooting first", 'A' + i);
+        PrintRate(label, s->winsFirst[i], s->movedFirst[i]);
+    }
+    PrintRate("first shooter wins", s->winsFirst[0] + s->winsFirst[1], decided);
+    printf("  %-30s %llu\n", "unfinished games",
+           (unsigned long long)s->draws);
+    if (s->badCommitments)
+    {
+        printf("  %-30s %llu\n", "failed commitments", (unsigned long long)s->badCommitments);
+    }
+
+    printf("\nShots fired by the winner\n");
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        printf("  %c mean %.2f\n", 'A' + i,
+               s->wins[i] ? (double)s->winShots[i] / s->wins[i] : 0.0);
+    }
+    uint64_t peak = 1;
+    for (uint16_t n = 0; n <= SIM_MAX_SHOTS; n++)
+    {
+        peak = (s->shotHist[n] > peak) ? s->shotHist[n] : peak;
+    }
+    uint64_t below = 0;
+    uint8_t median = 0, p10 = 0, p90 = 0;
+    printf("  %5s %10s %7s %7s\n", "shots", "games", "%", "cum %");
+    for (uint16_t n = 0; n <= SIM_MAX_SHOTS; n++)
+    {
+        if (!s->shotHist[n])
+        {
+            continue;
+        }
+        if (below * 10 < decided)
+        {
+            p10 = n;
+        }
+        if (below * 2 < decided)
+        {
+            median = n;
+        }
+        if (below * 10 < decided * 9)
+        {
+            p90 = n;
+        }
+        below += s->shotHist[n];
+        char bar[41];
+        uint8_t width = (uint8_t)(40 * s->shotHist[n] / peak);
+        memset(bar, '#', width);
+        bar[width] = '\0';
+        printf("  %5u %10llu %6.2f%% %6.2f%% %s\n", n, (unsigned long long)s->shotHist[n],
+               100.0 * s->shotHist[n] / decided, 100.0 * below / decided, bar);
+    }
+    printf("  p10 %u, median %u, p90 %u\n", p10, median, p90);
+
+    printf("\nThroughput\n");
+    printf("  %.0f games/s, %.2f million games/minute, %.2f s wall\n",
+           s->games / seconds, s->games * 60 / seconds / 1e6, seconds);
+
+    uint64_t busy = 0;
+    for (uint8_t p = 0; p < SIM_NUM_PHASES; p++)
+    {
+        busy += s->phaseNanos[p];
+    }
+    printf("\nTime per game, summed over threads\n");
+    for (uint8_t p = 0; p < SIM_NUM_PHASES; p++)
+    {
+        printf("  %-12s %10.3f us %6.2f%%\n", phaseNames[p],
+               s->phaseNanos[p] / 1e3 / s->games, busy ? 100.0 * s->phaseNanos[p] / busy : 0.0);
+    }
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        printf("  %c decide   %10.3f us per shot (1 game in %u timed)\n", 'A' + i,
+               s->decideShots[i] ? s->decideNanos[i] / 1e3 / s->decideShots[i] : 0.0,
+               SIM_TIMED_EVERY);
+    }
+
+    if (sharedCache != NULL)
+    {
+        printf("\nCache, %u entries (%u KB) shared by both sides\n", sharedCache->count,
+               (unsigned)(sharedCache->count * sizeof(FieldCacheSlot) / 1024));
+        for (uint8_t i = 0; i < 2; i++)
+        {
+            snprintf(label, sizeof(label), "%c hits", 'A' + i);
+            PrintRate(label, s->cacheHits[i], s->cacheLookups[i]);
+            printf("  %-30s %llu stores, %llu evictions\n", "",
+                   (unsigned long long)s->cacheStores[i],
+                   (unsigned long long)s->cacheEvictions[i]);
+        }
+    }
+}
+
+static void Usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [-n games] [-a policy] [-b policy] [-j threads] [-s seed]"
+            " [-S samples] [-D micros] [-C entries]\n", argv0);
+    fprintf(stderr, "  each side is policy[/placer], from:\n");
+    for (uint8_t i = 0; i < FieldPolicyCount(); i++)
+    {
+        const FieldPolicy *policy = FieldPolicyGet(i);
+        fprintf(stderr, "    %-10s %s\n", policy->name, policy->description);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    SimPolicy policyA, policyB;
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t games = DEFAULT_GAMES;
+    uint32_t threads = (online > 0) ? (uint32_t)online : 1;
+    unsigned seed = 1;
+    uint32_t cacheEntries = 0;
+    int opt;
+
+    ParsePolicy("density", &policyA);
+    ParsePolicy("stock", &policyB);
+    while ((opt = getopt(argc, argv, "n:a:b:j:s:S:D:C:h")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            games = strtoull(optarg, NULL, 10);
+            break;
+        case 'a':
+        case 'b':
+            if (ParsePolicy(optarg, (opt == 'a') ? &policyA : &policyB) != SUCCESS)
+            {
+                fprintf(stderr, "unknown policy '%s'\n", optarg);
+                Usage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'j':
+            threads = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 's':
+            seed = (unsigned)strtoul(optarg, NULL, 10);
+            break;
+        case 'S':
+            samplesPerShot = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'D':
+            deadlineMicros = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'C':
+            cacheEntries = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        default:
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    if (threads > MAX_THREADS)
+    {
+        threads = MAX_THREADS;
+    }
+    if (samplesPerShot < 1)
+    {
+        samplesPerShot = 1;
+    }
+    if (cacheEntries)
+    {
+        FieldCacheSlot *slots = malloc(sizeof(FieldCacheSlot) * cacheEntries);
+        if (FieldCacheInit(&cache, slots, cacheEntries) != SUCCESS)
+        {
+            fprintf(stderr, "-C takes a power of two\n");
+            return 1;
+        }
+        sharedCache = &cache;
+    }
+    Rng rng;
+    RngSeed(&rng, seed);
+
+    const SimPolicy *policy[2] = {&policyA, &policyB};
+    static SimWorker workers[MAX_THREADS];
+    pthread_t ids[MAX_THREADS];
+    printf("=== bb_sim: %llu games, A %s vs B %s, %u threads, seed %u ===\n",
+           (unsigned long long)games, policyA.name, policyB.name, threads, seed);
+
+    // Each worker plays a contiguous, even-sized block of game numbers so
+    // that the challenger role stays balanced
+    uint64_t next = 0;
+    uint64_t start = NowNanos();
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        uint64_t share = (games - next) / (threads - t);
+        share += share & 1;
+        share = (share > games - next) ? games - next : share;
+        workers[t].policy[0] = &policyA;
+        workers[t].policy[1] = &policyB;
+        workers[t].firstGame = next;
+        workers[t].games = share;
+        RngSplit(&rng, &workers[t].rng);
+        next += share;
+        pthread_create(&ids[t], NULL, Work, &workers[t]);
+    }
+    SimStats total;
+    memset(&total, 0, sizeof(total));
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        pthread_join(ids[t], NULL);
+        AddStats(&total, &workers[t].stats);
+    }
+    double seconds = (NowNanos() - start) / 1e9;
+
+    if (total.games)
+    {
+        Report(&total, policy, seconds);
+    }
+    return 0;
+}
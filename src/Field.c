@@ -8,26 +8,184 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "Field.h"
+#include "FieldAttribution.h"
+#include "FieldDensity.h"
+#include "FieldExact.h"
+#include "FieldOpening.h"
+#include "FieldPlacement.h"
+#include "FieldSampler.h"
+#include "Rng.h"
 #include "BOARD.h"
 
+#ifndef STM32F4
+#include <time.h>
+#endif
+
 /*  MODULE-LEVEL DEFINITIONS, MACROS    */
 
-/**
- * Define the dimensions of the game field. They can be overridden by
- * compile-time specifications. All references to the dimensions of the field
- * should use these constants instead of hard-coding a numeric value so that the
- * field dimensions can be changed with minimal coding changes.
+// State behind FieldAIDecideGuess(); reset by FieldInit()
+static FieldAIState fieldAIDefaultState;
+
+// Boats are placed largest first, while there is the most room for them
+static const BoatType fieldAIPlacementOrder[FIELD_NUM_BOATS] = {
+    FIELD_BOAT_TYPE_HUGE,
+    FIELD_BOAT_TYPE_LARGE,
+    FIELD_BOAT_TYPE_MEDIUM,
+    FIELD_BOAT_TYPE_SMALL};
+
+// The small boat has the most placements, so it bounds every candidate list
+#define FIELD_AI_MAX_PLACEMENTS FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_SMALL)
+
+// Fleets to draw in FieldAIPlaceAllBoatsUniform() before giving up
+#define FIELD_AI_UNIFORM_ATTEMPTS 1000
+
+// FieldAIDecideGuessWithin(): the exact solver gets 1/FIELD_AI_EXACT_SHARE of
+// the time left, so that an overrun still leaves time to sample, and a solve
+// that does not finish is always followed by at least this many samples
+#define FIELD_AI_EXACT_SHARE 4
+#define FIELD_AI_MIN_SAMPLES 64
+
+// Zobrist key numbering: one per square and plane, then one per boat type
+#define FIELD_HASH_SQUARE(index, p) ((index) * FIELD_NUM_PLANES + (p))
+#define FIELD_HASH_BOAT(type) (FIELD_NUM_SQUARES * FIELD_NUM_PLANES + (type))
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldHashKey(n)
+ *
+ * The Zobrist key numbered n. The keys are the splitmix64 sequence, computed
+ * on demand rather than stored: a write only needs two of them.
  */
-#define FIELD_COLS 10
-#define FIELD_ROWS 6
+static uint64_t FieldHashKey(uint16_t n)
+{
+    uint64_t z = (uint64_t)(n + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
 
-/**
- * Specify how many boats there exist on the field. There is 1 boat of each of
- * the 4 types, so 4 total.
+/** FieldHashBoats(afloat)
+ *
+ * The XOR of the keys of the boats in afloat, a FieldGetBoatStates() value.
+ * Passing the XOR of the states before and after a change gives the update.
+ */
+static uint64_t FieldHashBoats(uint8_t afloat)
+{
+    uint64_t hash = 0;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (afloat & (1 << type))
+        {
+            hash ^= FieldHashKey(FIELD_HASH_BOAT(type));
+        }
+    }
+    return hash;
+}
+
+/** FieldWriteSquare(*f, row, col, p)
+ *
+ * Stores p at (row, col) and moves that square's bit from its old plane to the
+ * plane for p, updating the hash to match. All grid writes go through here so
+ * that the bitboards never drift from the grid. Bounds are the caller's
+ * responsibility.
+ */
+static void FieldWriteSquare(Field *f, uint8_t row, uint8_t col, SquareStatus p)
+{
+    uint8_t index = FIELD_BITBOARD_INDEX(row, col);
+    FieldBitboard bit = (FieldBitboard)1 << index;
+    uint8_t old = f->grid[row][col];
+
+    if (old < FIELD_NUM_PLANES)
+    {
+        f->planes[old] &= ~bit;
+        f->hash ^= FieldHashKey(FIELD_HASH_SQUARE(index, old));
+    }
+    if (p < FIELD_NUM_PLANES)
+    {
+        f->planes[p] |= bit;
+        f->hash ^= FieldHashKey(FIELD_HASH_SQUARE(index, p));
+    }
+    f->grid[row][col] = p;
+}
+
+/** FieldClearBoatTable(*f)
+ *
+ * Empties the boat table and marks every square as holding no numbered boat.
  */
-#define FIELD_NUM_BOATS 4
+static void FieldClearBoatTable(Field *f)
+{
+    memset(f->boatId, FIELD_NO_BOAT, sizeof(f->boatId));
+    f->numBoats = 0;
+}
+
+/** FieldAIFreePlacements(*f, type, candidates)
+ *
+ * Collects the placements of a boat that lie entirely on empty squares.
+ *
+ * @return  The number of indices into fieldPlacements[] written.
+ */
+static uint8_t FieldAIFreePlacements(const Field *f, BoatType type,
+                                     uint16_t candidates[FIELD_AI_MAX_PLACEMENTS])
+{
+    FieldBitboard empty = f->planes[FIELD_SQUARE_EMPTY];
+    uint8_t n = 0;
+
+    for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+    {
+        if (!FieldBitboardAndNot(fieldPlacements[p].mask, empty))
+        {
+            candidates[n++] = p;
+        }
+    }
+    return n;
+}
+
+/** FieldAIHuntGuess(*oppField, *guess)
+ *
+ * Picks a hunting square from a lattice that every surviving boat must cross.
+ * The lattice is spaced by the shortest boat still afloat, so it thins out as
+ * the short boats sink. Of its offsets, the one with the fewest unknown
+ * squares left takes the fewest shots to finish; after a boat sinks, that is
+ * the one the earlier, closer-spaced shots have covered most of.
+ *
+ * @return  SUCCESS, or STANDARD_ERROR if no lattice square is unknown.
+ */
+static uint8_t FieldAIHuntGuess(const Field *oppField, GuessData *guess)
+{
+    FieldBitboard unknown = oppField->planes[FIELD_SQUARE_UNKNOWN];
+    uint8_t afloat = FieldGetBoatStates(oppField);
+    uint8_t type = 0;
+    FieldBitboard best = 0;
+
+    if (!afloat)
+    {
+        return STANDARD_ERROR;
+    }
+    while (!(afloat & (1 << type)))
+    {
+        type++;
+    }
+    for (uint8_t offset = 0; offset < fieldBoatSizes[type]; offset++)
+    {
+        FieldBitboard open = FieldBitboardAnd(fieldHuntLattices[type][offset], unknown);
+        if (open && (!best || FieldBitboardCount(open) < FieldBitboardCount(best)))
+        {
+            best = open;
+        }
+    }
+    if (!best)
+    {
+        return STANDARD_ERROR;
+    }
+    uint8_t i = FieldBitboardFirst(best);
+    guess->row = FIELD_BITBOARD_ROW(i);
+    guess->col = FIELD_BITBOARD_COL(i);
+    guess->result = RESULT_MISS;
+    return SUCCESS;
+}
 
 /*  PROTOTYPES  */
 
@@ -61,26 +219,47 @@ void FieldPrint_UART(Field *ownField, Field *oppField);
  */
 void FieldInit(Field *ownField, Field *oppField)
 {
-    for (uint8_t row = 0; row < FIELD_ROWS; row++)
+    // Either field may be NULL when only one of them is needed
+    if (ownField != NULL)
     {
-        for (uint8_t col = 0; col < FIELD_COLS; col++)
+        for (uint8_t row = 0; row < FIELD_ROWS; row++)
         {
-            ownField->grid[row][col] = FIELD_SQUARE_EMPTY;
-            oppField->grid[row][col] = FIELD_SQUARE_UNKNOWN;
+            for (uint8_t col = 0; col < FIELD_COLS; col++)
+            {
+                ownField->grid[row][col] = FIELD_SQUARE_EMPTY;
+            }
         }
+
+        // Player's boat lives initialized to 0 (set later upon placement)
+        ownField->smallBoatLives = 0;
+        ownField->mediumBoatLives = 0;
+        ownField->largeBoatLives = 0;
+        ownField->hugeBoatLives = 0;
+        FieldClearBoatTable(ownField);
+        FieldSyncBitboards(ownField);
     }
 
-    // Player's boat lives initialized to 0 (set later upon placement)
-    ownField->smallBoatLives = 0;
-    ownField->mediumBoatLives = 0;
-    ownField->largeBoatLives = 0;
-    ownField->hugeBoatLives = 0;
+    if (oppField != NULL)
+    {
+        for (uint8_t row = 0; row < FIELD_ROWS; row++)
+        {
+            for (uint8_t col = 0; col < FIELD_COLS; col++)
+            {
+                oppField->grid[row][col] = FIELD_SQUARE_UNKNOWN;
+            }
+        }
+
+        // Opponent's boat lives set to max
+        oppField->smallBoatLives = FIELD_BOAT_SIZE_SMALL;
+        oppField->mediumBoatLives = FIELD_BOAT_SIZE_MEDIUM;
+        oppField->largeBoatLives = FIELD_BOAT_SIZE_LARGE;
+        oppField->hugeBoatLives = FIELD_BOAT_SIZE_HUGE;
+        FieldClearBoatTable(oppField);
+        FieldSyncBitboards(oppField);
 
-    // Opponent's boat lives set to max
-    oppField->smallBoatLives = FIELD_BOAT_SIZE_SMALL;
-    oppField->mediumBoatLives = FIELD_BOAT_SIZE_MEDIUM;
-    oppField->largeBoatLives = FIELD_BOAT_SIZE_LARGE;
-    oppField->hugeBoatLives = FIELD_BOAT_SIZE_HUGE;
+        // A fresh opponent field means a new game for the default AI state
+        FieldAIStateInit(&fieldAIDefaultState);
+    }
 }
 
 /** FieldGetSquareStatus(*f, row, col)
@@ -126,7 +305,7 @@ SquareStatus FieldSetSquareStatus(
         return FIELD_SQUARE_INVALID;
     }
     SquareStatus oldStatus = (SquareStatus)f->grid[row][col];
-    f->grid[row][col] = p;
+    FieldWriteSquare(f, row, col, p);
     return oldStatus;
 }
 
@@ -209,33 +388,49 @@ uint8_t FieldAddBoat(Field *ownField, uint8_t row, uint8_t col,
         return STANDARD_ERROR;
     }
 
-    // Check boundaries
-    if ((dir == FIELD_DIR_EAST && (col + length > FIELD_COLS)) ||
-        (dir == FIELD_DIR_SOUTH && (row + length > FIELD_ROWS)))
+    // Look up the boat's squares. A zero mask means the boat would leave the
+    // field.
+    if (row >= FIELD_ROWS || col >= FIELD_COLS ||
+        (dir != FIELD_DIR_SOUTH && dir != FIELD_DIR_EAST))
+    {
+        return STANDARD_ERROR;
+    }
+    FieldBitboard boatMask = fieldPlacementMasks[boatType][row][col][dir];
+    if (!boatMask)
     {
         // printf("a\n");
         return STANDARD_ERROR;
     }
 
-    // Check overlap
-    for (uint8_t i = 0; i < length; i++)
+    // Check overlap: every square of the boat must currently be empty
+    if (FieldBitboardAndNot(boatMask, ownField->planes[FIELD_SQUARE_EMPTY]))
     {
-        uint8_t r = row + ((dir == FIELD_DIR_SOUTH) ? i : 0);
-        uint8_t c = col + ((dir == FIELD_DIR_EAST) ? i : 0);
-        if (ownField->grid[r][c] != FIELD_SQUARE_EMPTY)
-        {
-            // printf("b\n");
-            return STANDARD_ERROR;
-        }
+        // printf("b\n");
+        return STANDARD_ERROR;
+    }
+
+    // Number the boat
+    if (ownField->numBoats >= FIELD_MAX_BOATS)
+    {
+        return STANDARD_ERROR;
     }
+    uint8_t id = ownField->numBoats++;
+    ownField->boatType[id] = boatType;
+    ownField->boatLives[id] = length;
 
     // Place boat squares
-    for (uint8_t i = 0; i < length; i++)
+    uint8_t afloat = FieldGetBoatStates(ownField);
+    FieldBitboard todo = boatMask;
+    while (todo)
     {
-        uint8_t r = row + ((dir == FIELD_DIR_SOUTH) ? i : 0);
-        uint8_t c = col + ((dir == FIELD_DIR_EAST) ? i : 0);
-        ownField->grid[r][c] = boatStatus;
+        uint8_t i = FieldBitboardPopFirst(&todo);
+        ownField->grid[FIELD_BITBOARD_ROW(i)][FIELD_BITBOARD_COL(i)] = boatStatus;
+        ownField->boatId[FIELD_BITBOARD_ROW(i)][FIELD_BITBOARD_COL(i)] = id;
+        ownField->hash ^= FieldHashKey(FIELD_HASH_SQUARE(i, FIELD_SQUARE_EMPTY)) ^
+                FieldHashKey(FIELD_HASH_SQUARE(i, boatStatus));
     }
+    ownField->planes[FIELD_SQUARE_EMPTY] &= ~boatMask;
+    ownField->planes[boatStatus] |= boatMask;
 
     // Increment boat lives (supports multiple boats of the same type)
     switch (boatType)
@@ -253,6 +448,7 @@ uint8_t FieldAddBoat(Field *ownField, uint8_t row, uint8_t col,
         ownField->hugeBoatLives += length;
         break;
     }
+    ownField->hash ^= FieldHashBoats(afloat ^ FieldGetBoatStates(ownField));
     // printf("succeeding\n");
     return SUCCESS;
 }
@@ -287,50 +483,54 @@ SquareStatus FieldRegisterEnemyAttack(Field *ownField, GuessData *opp_guess)
     }
 
     SquareStatus current = ownField->grid[row][col];
+    uint8_t afloat = FieldGetBoatStates(ownField);
+    uint8_t *typeLives;
 
     switch (current)
     {
     case FIELD_SQUARE_SMALL_BOAT:
-        ownField->grid[row][col] = FIELD_SQUARE_HIT;
-        if (ownField->smallBoatLives > 0)
-            ownField->smallBoatLives--;
-        opp_guess->result = (ownField->smallBoatLives == 0) ? RESULT_SMALL_BOAT_SUNK : RESULT_HIT;
+        typeLives = &ownField->smallBoatLives;
         break;
-
     case FIELD_SQUARE_MEDIUM_BOAT:
-        ownField->grid[row][col] = FIELD_SQUARE_HIT;
-        if (ownField->mediumBoatLives > 0)
-            ownField->mediumBoatLives--;
-        opp_guess->result = (ownField->mediumBoatLives == 0) ? RESULT_MEDIUM_BOAT_SUNK : RESULT_HIT;
+        typeLives = &ownField->mediumBoatLives;
         break;
-
     case FIELD_SQUARE_LARGE_BOAT:
-        ownField->grid[row][col] = FIELD_SQUARE_HIT;
-        if (ownField->largeBoatLives > 0)
-            ownField->largeBoatLives--;
-        opp_guess->result = (ownField->largeBoatLives == 0) ? RESULT_LARGE_BOAT_SUNK : RESULT_HIT;
+        typeLives = &ownField->largeBoatLives;
         break;
-
     case FIELD_SQUARE_HUGE_BOAT:
-        ownField->grid[row][col] = FIELD_SQUARE_HIT;
-        if (ownField->hugeBoatLives > 0)
-            ownField->hugeBoatLives--;
-        opp_guess->result = (ownField->hugeBoatLives == 0) ? RESULT_HUGE_BOAT_SUNK : RESULT_HIT;
+        typeLives = &ownField->hugeBoatLives;
         break;
 
     case FIELD_SQUARE_EMPTY:
-        ownField->grid[row][col] = FIELD_SQUARE_MISS;
+        FieldWriteSquare(ownField, row, col, FIELD_SQUARE_MISS);
         opp_guess->result = RESULT_MISS;
-        break;
+        return current;
 
     case FIELD_SQUARE_HIT:
     case FIELD_SQUARE_MISS:
     default:
         // Already attacked this position or invalid, count as miss
         opp_guess->result = RESULT_MISS;
-        break;
+        return current;
+    }
+
+    // A boat square: the numbered boat sinks with its own last square, an
+    // unnumbered one with the last square of its type
+    FieldWriteSquare(ownField, row, col, FIELD_SQUARE_HIT);
+    if (*typeLives > 0)
+    {
+        (*typeLives)--;
+    }
+    uint8_t id = FieldGetBoatId(ownField, row, col);
+    uint8_t sunk = (*typeLives == 0);
+    if (id != FIELD_NO_BOAT && ownField->boatLives[id] > 0)
+    {
+        sunk = (--ownField->boatLives[id] == 0);
     }
+    opp_guess->result = sunk ?
+            RESULT_SMALL_BOAT_SUNK + (current - FIELD_SQUARE_SMALL_BOAT) : RESULT_HIT;
 
+    ownField->hash ^= FieldHashBoats(afloat ^ FieldGetBoatStates(ownField));
     return current;
 }
 
@@ -381,6 +581,7 @@ SquareStatus FieldUpdateKnowledge(Field *oppField, const GuessData *own_guess)
 
     // Save the previous status to return it
     SquareStatus prevStatus = (SquareStatus)oppField->grid[row][col];
+    uint8_t afloat = FieldGetBoatStates(oppField);
 
     // Always update the grid for a known hit or miss
     switch (own_guess->result)
@@ -390,11 +591,11 @@ SquareStatus FieldUpdateKnowledge(Field *oppField, const GuessData *own_guess)
     case RESULT_MEDIUM_BOAT_SUNK:
     case RESULT_LARGE_BOAT_SUNK:
     case RESULT_HUGE_BOAT_SUNK:
-        oppField->grid[row][col] = FIELD_SQUARE_HIT;
+        FieldWriteSquare(oppField, row, col, FIELD_SQUARE_HIT);
         break;
 
     case RESULT_MISS:
-        oppField->grid[row][col] = FIELD_SQUARE_MISS;
+        FieldWriteSquare(oppField, row, col, FIELD_SQUARE_MISS);
         break;
 
     default:
@@ -425,6 +626,7 @@ SquareStatus FieldUpdateKnowledge(Field *oppField, const GuessData *own_guess)
         break;
     }
 
+    oppField->hash ^= FieldHashBoats(afloat ^ FieldGetBoatStates(oppField));
     return prevStatus;
 }
 
@@ -465,6 +667,22 @@ uint8_t FieldGetBoatStates(const Field *f)
     return status;
 }
 
+/** FieldGetBoatId(*f, row, col)
+ *
+ * @param   *f  The field being referenced.
+ * @param   row The row-component of the location to look up.
+ * @param   col The column-component of the location to look up.
+ * @return  The boat's number, or FIELD_NO_BOAT.
+ */
+uint8_t FieldGetBoatId(const Field *f, uint8_t row, uint8_t col)
+{
+    if (row >= FIELD_ROWS || col >= FIELD_COLS || f->boatId[row][col] >= f->numBoats)
+    {
+        return FIELD_NO_BOAT;
+    }
+    return f->boatId[row][col];
+}
+
 /** FieldAIPlaceAllBoats(*ownField)
  *
  * This function is responsible for placing all four of the boats on a field.
@@ -476,40 +694,84 @@ uint8_t FieldGetBoatStates(const Field *f)
  */
 uint8_t FieldAIPlaceAllBoats(Field *ownField)
 {
-    BoatType boatTypes[] = {
-        FIELD_BOAT_TYPE_HUGE,
-        FIELD_BOAT_TYPE_LARGE,
-        FIELD_BOAT_TYPE_MEDIUM,
-        FIELD_BOAT_TYPE_SMALL};
+    return FieldAIPlaceAllBoatsRng(ownField, RngDefault());
+}
+
+/** FieldAIPlaceAllBoatsRng(*ownField, *rng)
+ *
+ * @param   f       Agent's own field, to be modified in place.
+ * @param   *rng    The generator.
+ * @return  SUCCESS if all boats could be placed, STANDARD_ERROR otherwise.
+ */
+uint8_t FieldAIPlaceAllBoatsRng(Field *ownField, Rng *rng)
+{
+    uint16_t candidates[FIELD_AI_MAX_PLACEMENTS];
 
     for (uint8_t i = 0; i < FIELD_NUM_BOATS; i++)
     {
-        // uint8_t placed = 0;
-        // while (!placed)
-        // {
-        //     uint8_t row = rand() % FIELD_ROWS;
-        //     uint8_t col = rand() % FIELD_COLS;
-        //     BoatDirection dir = (rand() % 2 == 0) ? FIELD_DIR_SOUTH : FIELD_DIR_EAST;
+        uint8_t n = FieldAIFreePlacements(ownField, fieldAIPlacementOrder[i], candidates);
+        if (n == 0)
+        {
+            return STANDARD_ERROR;
+        }
+
+        const FieldPlacement *p = &fieldPlacements[candidates[RngBelow(rng, n)]];
+        FieldAddBoat(ownField, p->row, p->col, p->dir, p->type);
+    }
+
+    return SUCCESS;
+}
+
+/** FieldAIPlaceAllBoatsUniform(*ownField)
+ *
+ * Places all four boats so that every whole-fleet configuration is equally
+ * likely.
+ *
+ * @param   f   Agent's own field, to be modified in place.
+ * @return  SUCCESS if all boats could be placed, STANDARD_ERROR otherwise.
+ */
+uint8_t FieldAIPlaceAllBoatsUniform(Field *ownField)
+{
+    return FieldAIPlaceAllBoatsUniformRng(ownField, RngDefault());
+}
+
+/** FieldAIPlaceAllBoatsUniformRng(*ownField, *rng)
+ *
+ * @param   f       Agent's own field, to be modified in place.
+ * @param   *rng    The generator.
+ * @return  SUCCESS if all boats could be placed, STANDARD_ERROR otherwise.
+ */
+uint8_t FieldAIPlaceAllBoatsUniformRng(Field *ownField, Rng *rng)
+{
+    uint16_t candidates[FIELD_AI_MAX_PLACEMENTS];
 
-        //     if (FieldAddBoat(ownField, row, col, dir, boatTypes[i]) == SUCCESS)
-        //     {
-        //         placed = 1;
-        //     }
-        // }
+    for (uint16_t attempt = 0; attempt < FIELD_AI_UNIFORM_ATTEMPTS; attempt++)
+    {
+        Field work = *ownField;
+        uint8_t i;
+        for (i = 0; i < FIELD_NUM_BOATS; i++)
+        {
+            BoatType type = fieldAIPlacementOrder[i];
+            uint8_t n = FieldAIFreePlacements(&work, type, candidates);
 
-        uint8_t row = rand() % FIELD_ROWS;
-        uint8_t col = rand() % FIELD_COLS;
-        BoatDirection dir = (rand() % 2 == 0) ? FIELD_DIR_SOUTH : FIELD_DIR_EAST;
+            // Draw from every in-bounds placement; the free ones come first
+            uint16_t r = RngBelow(rng, fieldPlacementFirst[type + 1] - fieldPlacementFirst[type]);
+            if (r >= n)
+            {
+                break;
+            }
+            const FieldPlacement *p = &fieldPlacements[candidates[r]];
+            FieldAddBoat(&work, p->row, p->col, p->dir, p->type);
+        }
 
-        while (!(FieldAddBoat(ownField, row, col, dir, boatTypes[i])))
+        if (i == FIELD_NUM_BOATS)
         {
-            row = rand() % FIELD_ROWS;
-            col = rand() % FIELD_COLS;
-            dir = (rand() % 2 == 0) ? FIELD_DIR_SOUTH : FIELD_DIR_EAST;
+            *ownField = work;
+            return SUCCESS;
         }
     }
 
-    return SUCCESS;
+    return STANDARD_ERROR;
 }
 
 /** FieldAIDecideGuess(*oppField)
@@ -519,8 +781,7 @@ uint8_t FieldAIPlaceAllBoats(Field *ownField)
  * This function should not attempt to shoot a square which has already been
  * guessed.
  *
- * You may wish to give this function static variables.  If so, that data should
- * be reset when FieldInit() is called.
+ * Uses the module-level state, which FieldInit() resets.
  *
  * @param   *f  An opponent's field.
  * @return  A GuessData struct whose row and col parameters are the coordinates
@@ -528,79 +789,181 @@ uint8_t FieldAIPlaceAllBoats(Field *ownField)
  */
 GuessData FieldAIDecideGuess(const Field *oppField)
 {
-    static uint8_t targeting = 0;
-    static uint8_t orientationKnown = 0; // 0 = unknown, 1 = horiz, 2 = vert
-    static int8_t direction = -1;        // 0=N,1=S,2=W,3=E
-    static uint8_t reverse = 0;
-    static uint8_t hitsInARow = 0;
+    return FieldAIStateDecideGuess(&fieldAIDefaultState, oppField);
+}
+
+/** FieldAIStateInit(*state)
+ *
+ * Prepares a state for a new game.
+ *
+ * @param   *state  The state to initialize.
+ */
+void FieldAIStateInit(FieldAIState *state)
+{
+    FieldAIStateInitRng(state, RngDefault());
+}
+
+/** FieldAIStateInitRng(*state, *rng)
+ *
+ * @param   *state  The state to initialize.
+ * @param   *rng    The generator.
+ */
+void FieldAIStateInitRng(FieldAIState *state, Rng *rng)
+{
+    FieldAIStateReset(state);
+    state->lastGuess.row = 0;
+    state->lastGuess.col = 0;
+    state->lastGuess.result = RESULT_MISS;
 
-    static uint8_t originRow = FIELD_ROWS;
-    static uint8_t originCol = FIELD_COLS;
+    state->attributeSunk = 1;
+    state->resolve = 0;
+    state->hits = 0;
+    state->dead = 0;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        state->sunkSquare[type] = FIELD_NUM_SQUARES;
+        state->hitsAtSink[type] = FIELD_BITBOARD_ALL;
+    }
+    state->rng = FieldSamplerSeed(RngNext(rng), 0);
+}
 
-    static GuessData lastGuess = {.result = RESULT_MISS, .row = 0, .col = 0};
+/** FieldAIStateReset(*state)
+ *
+ * Drops the current target and goes back to hunting.
+ *
+ * @param   *state  The state to reset.
+ */
+void FieldAIStateReset(FieldAIState *state)
+{
+    state->targeting = 0;
+    state->orientationKnown = 0;
+    state->direction = -1;
+    state->reverse = 0;
+    state->hitsInARow = 0;
+    state->originRow = FIELD_ROWS;
+    state->originCol = FIELD_COLS;
+}
+
+/** FieldAIStateUpdate(*state, *ownGuess)
+ *
+ * Reports the result of a shot.
+ *
+ * @param   *state      The state that chose the shot.
+ * @param   *ownGuess   The shot, with its result filled in.
+ */
+void FieldAIStateUpdate(FieldAIState *state, const GuessData *ownGuess)
+{
+    state->lastGuess = *ownGuess;
+    if (ownGuess->result != RESULT_MISS &&
+        ownGuess->row < FIELD_ROWS && ownGuess->col < FIELD_COLS)
+    {
+        state->hits |= FIELD_BITBOARD_SQUARE(ownGuess->row, ownGuess->col);
+    }
 
-    static int8_t directions[4][2] = {
+    // If last result was a sunk boat, reset targeting mode
+    if (ownGuess->result >= RESULT_SMALL_BOAT_SUNK &&
+        ownGuess->result <= RESULT_HUGE_BOAT_SUNK)
+    {
+        uint8_t type = ownGuess->result - RESULT_SMALL_BOAT_SUNK;
+        state->sunkSquare[type] = FIELD_BITBOARD_INDEX(ownGuess->row, ownGuess->col);
+        state->hitsAtSink[type] = state->hits;
+        state->resolve = 1;
+        FieldAIStateReset(state);
+    }
+
+    // If last result was a hit (and not a sunk boat), enter or continue targeting
+    if (ownGuess->result == RESULT_HIT)
+    {
+        if (!state->targeting)
+        {
+            state->targeting = 1;
+            state->originRow = ownGuess->row;
+            state->originCol = ownGuess->col;
+        }
+        state->hitsInARow++;
+    }
+}
+
+/** FieldAIStateDecideGuess(*state, *oppField)
+ *
+ * Reentrant version of FieldAIDecideGuess().
+ *
+ * @param   *state      This game's AI state.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldAIStateDecideGuess(FieldAIState *state, const Field *oppField)
+{
+    static const int8_t directions[4][2] = {
         {-1, 0}, {1, 0}, {0, -1}, {0, 1} // N, S, W, E
     };
 
     GuessData guess;
     guess.result = RESULT_MISS;
 
-    // If last result was a sunk boat, reset targeting mode
-    if (lastGuess.result >= RESULT_SMALL_BOAT_SUNK &&
-        lastGuess.result <= RESULT_HUGE_BOAT_SUNK)
+    // ---------- Unresolved Hits ----------
+    if (state->attributeSunk && state->resolve)
     {
-        targeting = 0;
-        orientationKnown = 0;
-        direction = -1;
-        reverse = 0;
-        hitsInARow = 0;
-        originRow = FIELD_ROWS;
-        originCol = FIELD_COLS;
+        state->dead = FieldAttributeSunk(oppField, state->sunkSquare, state->hitsAtSink, NULL);
+        state->resolve = 0;
     }
-
-    // If last result was a hit (and not a sunk boat), enter or continue targeting
-    if (lastGuess.result == RESULT_HIT)
+    if (state->attributeSunk && !state->targeting)
     {
-        if (!targeting)
+        // Chase a hit that no sunk boat accounts for, if it has open neighbours
+        FieldBitboard live = FieldBitboardAndNot(FieldGetBitboard(oppField, FIELD_SQUARE_HIT),
+                                                 state->dead);
+        while (live && !state->targeting)
         {
-            targeting = 1;
-            originRow = lastGuess.row;
-            originCol = lastGuess.col;
+            uint8_t i = FieldBitboardPopFirst(&live);
+            uint8_t row = FIELD_BITBOARD_ROW(i);
+            uint8_t col = FIELD_BITBOARD_COL(i);
+            if (FieldGetSquareStatus(oppField, row - 1, col) == FIELD_SQUARE_UNKNOWN ||
+                FieldGetSquareStatus(oppField, row + 1, col) == FIELD_SQUARE_UNKNOWN ||
+                FieldGetSquareStatus(oppField, row, col - 1) == FIELD_SQUARE_UNKNOWN ||
+                FieldGetSquareStatus(oppField, row, col + 1) == FIELD_SQUARE_UNKNOWN)
+            {
+                FieldAIStateReset(state);
+                state->targeting = 1;
+                state->originRow = row;
+                state->originCol = col;
+                state->hitsInARow = 1;
+            }
         }
-        hitsInARow++;
     }
 
     // ---------- Target Mode ----------
-    if (targeting)
+    if (state->targeting)
     {
-        if (orientationKnown && direction != -1)
+        if (state->orientationKnown && state->direction != -1)
         {
             // Continue in known direction
-            int8_t d = reverse ? (direction ^ 1) : direction; // flip direction if reversed
-            int8_t newRow = originRow + directions[d][0] * (hitsInARow + (reverse ? 0 : 1));
-            int8_t newCol = originCol + directions[d][1] * (hitsInARow + (reverse ? 0 : 1));
-            if (newRow < FIELD_ROWS && newCol < FIELD_COLS &&
+            int8_t d = state->reverse ? (state->direction ^ 1) : state->direction;
+            int8_t step = state->hitsInARow + (state->reverse ? 0 : 1);
+            int8_t newRow = state->originRow + directions[d][0] * step;
+            int8_t newCol = state->originCol + directions[d][1] * step;
+            if (newRow >= 0 && newRow < FIELD_ROWS &&
+                newCol >= 0 && newCol < FIELD_COLS &&
                 oppField->grid[newRow][newCol] == FIELD_SQUARE_UNKNOWN)
             {
                 guess.row = newRow;
                 guess.col = newCol;
                 return guess;
             }
-            else if (!reverse)
+            else if (!state->reverse)
             {
                 // Try reversing direction
-                reverse = 1;
-                return FieldAIDecideGuess(oppField); // retry with reversed
+                state->reverse = 1;
+                return FieldAIStateDecideGuess(state, oppField);
             }
             else
             {
                 // Reset if both directions failed
-                targeting = 0;
-                orientationKnown = 0;
-                direction = -1;
-                reverse = 0;
-                hitsInARow = 0;
+                state->targeting = 0;
+                state->orientationKnown = 0;
+                state->direction = -1;
+                state->reverse = 0;
+                state->hitsInARow = 0;
             }
         }
         else
@@ -608,8 +971,8 @@ GuessData FieldAIDecideGuess(const Field *oppField)
             // Orientation unknown: try all adjacent unknowns
             for (int8_t d = 0; d < 4; d++)
             {
-                int8_t newRow = originRow + directions[d][0];
-                int8_t newCol = originCol + directions[d][1];
+                int8_t newRow = state->originRow + directions[d][0];
+                int8_t newCol = state->originCol + directions[d][1];
                 if (newRow >= 0 && newRow < FIELD_ROWS &&
                     newCol >= 0 && newCol < FIELD_COLS &&
                     oppField->grid[newRow][newCol] == FIELD_SQUARE_UNKNOWN)
@@ -619,27 +982,33 @@ GuessData FieldAIDecideGuess(const Field *oppField)
 
                     // If this hit confirms orientation later
                     if (d == 0 || d == 1)
-                        orientationKnown = 2; // vertical
+                        state->orientationKnown = 2; // vertical
                     else
-                        orientationKnown = 1; // horizontal
+                        state->orientationKnown = 1; // horizontal
 
-                    direction = d;
+                    state->direction = d;
                     return guess;
                 }
             }
 
             // If no adjacent options, fall back to hunt mode
-            targeting = 0;
+            state->targeting = 0;
         }
     }
 
     // ---------- Hunt Mode ----------
+    if (FieldAIHuntGuess(oppField, &guess) == SUCCESS)
+    {
+        return guess;
+    }
+
+    // ---------- Fallback ----------
+    // Also reached by fields whose grid was written without FieldSyncBitboards()
     for (uint8_t row = 0; row < FIELD_ROWS; row++)
     {
         for (uint8_t col = 0; col < FIELD_COLS; col++)
         {
-            // Smarter parity (skip 75% of squares for faster search)
-            if ((row + col) % 4 == 0 && oppField->grid[row][col] == FIELD_SQUARE_UNKNOWN)
+            if (oppField->grid[row][col] == FIELD_SQUARE_UNKNOWN)
             {
                 guess.row = row;
                 guess.col = col;
@@ -648,21 +1017,175 @@ GuessData FieldAIDecideGuess(const Field *oppField)
         }
     }
 
-    // ---------- Fallback ----------
+    return guess;
+}
+
+/** FieldAIDefaultState()
+ *
+ * @return  The state used by FieldAIDecideGuess().
+ */
+FieldAIState *FieldAIDefaultState(void)
+{
+    return &fieldAIDefaultState;
+}
+
+/** FieldAIDecideGuessWithin(*oppField, *state, deadlineMicros, *stats)
+ *
+ * Picks the most likely square, doing as much search as fits before
+ * deadlineMicros.
+ *
+ * @param   *oppField       The opponent's field.
+ * @param   *state          Supplies the sampling stream, or NULL.
+ * @param   deadlineMicros  The FieldAIMicros() time by which to return.
+ * @param   *stats          If not NULL, receives how much search was done.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldAIDecideGuessWithin(const Field *oppField, FieldAIState *state,
+                                   uint32_t deadlineMicros, FieldAIStats *stats)
+{
+    FieldExact exact;
+    FieldSampler sampler;
+    FieldAIStats local;
+    uint32_t start = FieldAIMicros();
+
+    if (state == NULL)
+    {
+        state = &fieldAIDefaultState;
+    }
+    if (stats == NULL)
+    {
+        stats = &local;
+    }
+    stats->samples = 0;
+    stats->placements = 0;
+    stats->exact = 0;
+    stats->opening = 0;
+
+    GuessData guess;
+    if (FieldOpeningLookup(oppField, &guess) == SUCCESS)
+    {
+        stats->exact = 1;
+        stats->opening = 1;
+        stats->elapsedMicros = FieldAIMicros() - start;
+        return guess;
+    }
+    guess = FieldDensityDecideGuess(oppField);
+
+    // A deadline in the past shows up as a huge remaining time
+    uint32_t remaining = deadlineMicros - FieldAIMicros();
+    if (remaining > 0 && remaining < UINT32_MAX / 2)
+    {
+        uint32_t share = remaining / FIELD_AI_EXACT_SHARE;
+        FieldExactSolveWithin(&exact, oppField, share ? share : 1);
+        stats->placements = exact.total;
+        if (exact.complete && exact.total)
+        {
+            stats->exact = 1;
+            guess = FieldExactBestGuess(&exact, oppField);
+        }
+        else
+        {
+            // Sample until the deadline, but never skip sampling because the
+            // solver ran over
+            remaining = deadlineMicros - FieldAIMicros();
+            FieldSamplerInit(&sampler, state->rng);
+            if (remaining > 0 && remaining < UINT32_MAX / 2)
+            {
+                stats->samples = FieldSamplerRun(&sampler, oppField, 0, remaining);
+            }
+            if (stats->samples < FIELD_AI_MIN_SAMPLES)
+            {
+                stats->samples = FieldSamplerRun(&sampler, oppField, FIELD_AI_MIN_SAMPLES, 0);
+            }
+            state->rng = sampler.rng;
+            if (stats->samples)
+            {
+                guess = FieldSamplerBestGuess(&sampler, oppField);
+            }
+        }
+    }
+
+    stats->elapsedMicros = FieldAIMicros() - start;
+    return guess;
+}
+
+/** FieldAIMicros()
+ *
+ * The microsecond clock behind every AI time limit. This is a weak default;
+ * Lab10_main_ec.c replaces it on the Nucleo with a reading of htim2.
+ *
+ * @return  The current time in microseconds.
+ */
+__attribute__((weak)) uint32_t FieldAIMicros(void)
+{
+#ifdef STM32F4
+    return HAL_GetTick() * 1000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+/** FieldSyncBitboards(*f)
+ *
+ * Rebuilds every bit plane of a field, and its hash, from its grid and boat
+ * lives. This is only needed after writing to f->grid or the lives directly;
+ * the other Field functions keep the planes in sync on their own.
+ *
+ * @param   *f  The field to resynchronize.
+ */
+void FieldSyncBitboards(Field *f)
+{
+    for (uint8_t p = 0; p < FIELD_NUM_PLANES; p++)
+    {
+        f->planes[p] = 0;
+    }
+    f->hash = FieldHashBoats(FieldGetBoatStates(f));
+
     for (uint8_t row = 0; row < FIELD_ROWS; row++)
     {
         for (uint8_t col = 0; col < FIELD_COLS; col++)
         {
-            if (oppField->grid[row][col] == FIELD_SQUARE_UNKNOWN)
+            uint8_t status = f->grid[row][col];
+            if (status < FIELD_NUM_PLANES)
             {
-                guess.row = row;
-                guess.col = col;
-                return guess;
+                f->planes[status] |= FIELD_BITBOARD_SQUARE(row, col);
+                f->hash ^= FieldHashKey(FIELD_HASH_SQUARE(FIELD_BITBOARD_INDEX(row, col), status));
             }
         }
     }
+}
 
-    return guess;
+/** FieldGetBitboard(*f, p)
+ *
+ * Retrieves the set of squares that currently hold the status p. For example,
+ * FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN) is every square that has
+ * not been shot at yet.
+ *
+ * @param   *f  The field being referenced.
+ * @param   p   The status to look up.
+ * @return  A bitboard of all squares with status p, or 0 if p has no plane
+ *          (FIELD_SQUARE_CURSOR, FIELD_SQUARE_INVALID).
+ */
+FieldBitboard FieldGetBitboard(const Field *f, SquareStatus p)
+{
+    if (p >= FIELD_NUM_PLANES)
+    {
+        return 0;
+    }
+    return f->planes[p];
+}
+
+/** FieldGetHash(*f)
+ *
+ * @param   *f  The field being referenced.
+ * @return  The hash.
+ */
+uint64_t FieldGetHash(const Field *f)
+{
+    return f->hash;
 }
 
 /************************************************************
@@ -0,0 +1,932 @@
+/**
+ * @file    FieldAITest.c
+ *
+ * Test harness for the opponent-modeling AI engines built on top of the Field
+ * module.
+ *
+ * @date    16 Oct 2026
+ */
+
+// Standard C headers
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Project headers
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCache.h"
+#include "FieldCount.h"
+#include "FieldDensity.h"
+#include "FieldEntropy.h"
+#include "FieldExact.h"
+#include "FieldOpening.h"
+#include "FieldOpponent.h"
+#include "FieldPlacement.h"
+#include "FieldPolicy.h"
+#include "FieldSampler.h"
+#include "FieldSamplerParallel.h"
+#include "Rng.h"
+
+static int allTestsPassed = 1;
+
+// While nonzero, FieldAIMicros() is a fake clock that moves this many
+// microseconds per reading, so deadline tests do not depend on the machine
+static uint32_t testClockStep = 0;
+static uint32_t testClock = 0;
+
+/**
+ * Replaces the weak FieldAIMicros() in Field.c.
+ */
+uint32_t FieldAIMicros(void) {
+    if (testClockStep) {
+        testClock += testClockStep;
+        return testClock;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+// --------------------------- HELPER FUNCTION -------------------------------
+
+/**
+ * Helper function to print test result based on condition.
+ */
+void Check(bool condition, const char *testName) {
+    if (condition) {
+        printf(" %s passed\n", testName);
+    }
+    else {
+        printf(" %s FAILED\n", testName);
+        allTestsPassed = 0;
+    }
+}
+
+// --------------------------- FIELD SAMPLER TEST ----------------------------
+
+/**
+ * Tests that FieldSamplerRun only produces configurations consistent with the
+ * opponent field, and that it honors both of its limits.
+ */
+void TestFieldSampler() {
+    Field opp;
+    FieldSampler sampler;
+    FieldInit(NULL, &opp);
+    FieldSamplerInit(&sampler, 1234);
+
+    printf("Running FieldSampler tests...\n");
+
+    // --- Test 1: every sample on a fresh field covers all 18 boat squares ---
+    uint32_t accepted = FieldSamplerRun(&sampler, &opp, 5000, 0);
+    uint32_t covered = 0;
+    for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+        covered += sampler.tally[i];
+    }
+    uint32_t fleet = FIELD_BOAT_SIZE_SMALL + FIELD_BOAT_SIZE_MEDIUM +
+        FIELD_BOAT_SIZE_LARGE + FIELD_BOAT_SIZE_HUGE;
+    Check(accepted == 5000 && covered == 5000 * fleet, "FieldSampler fresh field sample count");
+
+    // --- Test 2: a miss is never covered ---
+    GuessData shot = { 2, 4, RESULT_MISS };
+    FieldUpdateKnowledge(&opp, &shot);
+    FieldSamplerRun(&sampler, &opp, 5000, 0);
+    Check(sampler.tally[FIELD_BITBOARD_INDEX(2, 4)] == 0, "FieldSampler miss square never covered");
+
+    // --- Test 3: after a lone hit, the best guess is next to it ---
+    shot.row = 3;
+    shot.col = 7;
+    shot.result = RESULT_HIT;
+    FieldUpdateKnowledge(&opp, &shot);
+    FieldSamplerRun(&sampler, &opp, 5000, 0);
+    GuessData guess = FieldSamplerBestGuess(&sampler, &opp);
+    int dr = (int)guess.row - 3;
+    int dc = (int)guess.col - 7;
+    Check(dr * dr + dc * dc == 1, "FieldSampler targets next to a lone hit");
+
+    // --- Test 4: a time budget alone stops the run, on the fake clock ---
+    testClockStep = 50;
+    uint32_t start = FieldSamplerMicros();
+    accepted = FieldSamplerRun(&sampler, &opp, 0, 2000);
+    uint32_t elapsed = FieldSamplerMicros() - start;
+    testClockStep = 0;
+    Check(accepted > 0 && elapsed <= 2000 + 2 * 50, "FieldSampler stops at its time budget");
+
+    // --- Test 5: an impossible field yields no samples, but still a guess ---
+    Field full;
+    FieldInit(NULL, &full);
+    for (int row = 0; row < FIELD_ROWS; row++) {
+        for (int col = 0; col < FIELD_COLS; col++) {
+            if (row != 0 || col != 0) {
+                FieldSetSquareStatus(&full, row, col, FIELD_SQUARE_MISS);
+            }
+        }
+    }
+    accepted = FieldSamplerRun(&sampler, &full, 100, 0);
+    guess = FieldSamplerBestGuess(&sampler, &full);
+    Check(accepted == 0 && guess.row == 0 && guess.col == 0, "FieldSampler impossible field");
+
+    printf("FieldSampler tests complete.\n");
+}
+
+// ----------------------- FIELD SAMPLER PARALLEL TEST ------------------------
+
+/**
+ * Tests that FieldSamplerRunParallel accepts exactly the samples asked for,
+ * with one worker or several, and that its merged tallies respect a miss.
+ */
+void TestFieldSamplerParallel() {
+    Field opp;
+    FieldSampler sampler;
+    GuessData shot = { 2, 4, RESULT_MISS };
+    uint32_t fleet = FIELD_BOAT_SIZE_SMALL + FIELD_BOAT_SIZE_MEDIUM +
+        FIELD_BOAT_SIZE_LARGE + FIELD_BOAT_SIZE_HUGE;
+    const uint16_t threads[] = {1, 4};
+    // Not a whole number of chunks, so the last chunk is partly used
+    const uint32_t wanted = 4999;
+
+    printf("Running FieldSamplerParallel tests...\n");
+
+    FieldInit(NULL, &opp);
+    FieldUpdateKnowledge(&opp, &shot);
+    for (uint8_t t = 0; t < 2; t++) {
+        FieldSamplerInit(&sampler, 99);
+        uint32_t accepted = FieldSamplerRunParallel(&sampler, &opp, wanted, 0, threads[t]);
+        uint32_t covered = 0;
+        for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+            covered += sampler.tally[i];
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "FieldSamplerRunParallel with %u thread%s", threads[t],
+                 threads[t] == 1 ? "" : "s");
+        Check(accepted == wanted && sampler.samples == wanted && covered == wanted * fleet &&
+              sampler.tally[FIELD_BITBOARD_INDEX(2, 4)] == 0, name);
+    }
+
+    printf("FieldSamplerParallel tests complete.\n");
+}
+
+// -------------------------- FIELD DENSITY MAP TEST --------------------------
+
+/**
+ * Tests that an incrementally updated FieldDensityMap always matches a full
+ * FieldDensityCompute() on the unknown squares.
+ */
+void TestFieldDensityMap() {
+    Field layout, opp;
+    FieldDensityMap map;
+    uint32_t density[FIELD_NUM_SQUARES];
+    FieldInit(&layout, &opp);
+    FieldAIPlaceAllBoats(&layout);
+    FieldDensityMapInit(&map, &opp);
+
+    printf("Running FieldDensityMap tests...\n");
+
+    // --- Test 1: incremental updates match a full rebuild over a whole game ---
+    bool matches = true;
+    bool incremental = true;
+    while (FieldGetBoatStates(&layout)) {
+        GuessData guess = FieldDensityMapBestGuess(&map, &opp);
+        FieldRegisterEnemyAttack(&layout, &guess);
+        FieldUpdateKnowledge(&opp, &guess);
+        incremental = incremental && FieldDensityMapUpdate(&map, &opp);
+        FieldDensityCompute(&opp, density);
+        for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+            if (FieldGetSquareStatus(&opp, FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i)) ==
+                FIELD_SQUARE_UNKNOWN && density[i] != map.density[i]) {
+                matches = false;
+            }
+        }
+    }
+    Check(matches && incremental, "FieldDensityMap incremental matches full");
+
+    // --- Test 2: a new game is detected and rebuilt ---
+    FieldInit(NULL, &opp);
+    uint8_t updated = FieldDensityMapUpdate(&map, &opp);
+    FieldDensityCompute(&opp, density);
+    Check(!updated && map.density[0] == density[0] && map.alive == FieldGetBoatStates(&opp),
+          "FieldDensityMap rebuilds on a new field");
+
+    printf("FieldDensityMap tests complete.\n");
+}
+
+// ---------------------------- FIELD EXACT TEST -----------------------------
+
+/**
+ * Tests that FieldExactSolve counts configurations correctly and agrees with
+ * the constraints the sampler enforces.
+ */
+void TestFieldExact() {
+    Field opp;
+    FieldExact exact;
+    FieldInit(NULL, &opp);
+
+    printf("Running FieldExact tests...\n");
+
+    // --- Test 1: on a fresh field every configuration covers all 18 squares ---
+    uint64_t total = FieldExactSolve(&exact, &opp);
+    uint64_t covered = 0;
+    for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+        covered += exact.tally[i];
+    }
+    uint64_t fleet = FIELD_BOAT_SIZE_SMALL + FIELD_BOAT_SIZE_MEDIUM +
+        FIELD_BOAT_SIZE_LARGE + FIELD_BOAT_SIZE_HUGE;
+    Check(total > 0 && covered == total * fleet, "FieldExact fresh field square count");
+
+    // --- Test 2: a miss is never covered and a hit always is ---
+    GuessData shot = { 2, 4, RESULT_MISS };
+    FieldUpdateKnowledge(&opp, &shot);
+    shot.row = 3;
+    shot.col = 7;
+    shot.result = RESULT_HIT;
+    FieldUpdateKnowledge(&opp, &shot);
+    uint64_t narrowed = FieldExactSolve(&exact, &opp);
+    Check(narrowed > 0 && narrowed < total &&
+          exact.tally[FIELD_BITBOARD_INDEX(2, 4)] == 0 &&
+          exact.tally[FIELD_BITBOARD_INDEX(3, 7)] == narrowed,
+          "FieldExact miss never covered, hit always covered");
+
+    // --- Test 3: the best guess is next to a lone hit ---
+    GuessData guess = FieldExactBestGuess(&exact, &opp);
+    int dr = (int)guess.row - 3;
+    int dc = (int)guess.col - 7;
+    Check(dr * dr + dc * dc == 1, "FieldExact targets next to a lone hit");
+
+    // --- Test 4: the sampler's frequencies match the exact probabilities ---
+    FieldSampler sampler;
+    FieldSamplerInit(&sampler, 99);
+    FieldSamplerRun(&sampler, &opp, 20000, 0);
+    double prob[FIELD_NUM_SQUARES];
+    FieldExactProbabilities(&exact, prob);
+    double worst = 0;
+    for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+        if (FieldGetSquareStatus(&opp, FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i)) ==
+            FIELD_SQUARE_UNKNOWN) {
+            double diff = (double)sampler.tally[i] / sampler.samples - prob[i];
+            worst = diff > worst ? diff : (-diff > worst ? -diff : worst);
+        }
+    }
+    Check(worst < 0.03, "FieldExact agrees with FieldSampler");
+
+    // --- Test 5: an impossible field has no configurations ---
+    Field full;
+    FieldInit(NULL, &full);
+    for (int row = 0; row < FIELD_ROWS; row++) {
+        for (int col = 0; col < FIELD_COLS; col++) {
+            if (row != 0 || col != 0) {
+                FieldSetSquareStatus(&full, row, col, FIELD_SQUARE_MISS);
+            }
+        }
+    }
+    Check(FieldExactSolve(&exact, &full) == 0, "FieldExact impossible field");
+
+    printf("FieldExact tests complete.\n");
+}
+
+// --------------------------- FIELD COUNT TEST ------------------------------
+
+/**
+ * Tests that FieldCount agrees with the exact solver and that every index
+ * unranks to its own legal fleet.
+ */
+void TestFieldCount() {
+    static FieldCount count;
+    Field empty;
+    FieldExact exact;
+    FieldInit(NULL, &empty);
+
+    printf("Running FieldCount tests...\n");
+
+    // --- Test 1: the count matches the exact solver on an empty field ---
+    uint32_t total = FieldCountInit(&count);
+    Check(total > 0 && total == FieldExactSolve(&exact, &empty) &&
+          FieldCountTotal(&count) == total, "FieldCount total matches FieldExact");
+
+    // --- Test 2: the first and last index place a full fleet ---
+    Field first, last, next;
+    FieldInit(&first, NULL);
+    FieldInit(&last, NULL);
+    FieldInit(&next, NULL);
+    Check(FieldCountUnrank(&count, 0, &first) == SUCCESS &&
+          FieldCountUnrank(&count, total - 1, &last) == SUCCESS &&
+          FieldGetBoatStates(&first) == FieldGetBoatStates(&last) &&
+          FieldGetBoatStates(&first) == (FIELD_BOAT_STATUS_SMALL | FIELD_BOAT_STATUS_MEDIUM |
+                                         FIELD_BOAT_STATUS_LARGE | FIELD_BOAT_STATUS_HUGE),
+          "FieldCountUnrank first and last index");
+
+    // --- Test 3: neighbouring indices give different fleets ---
+    FieldCountUnrank(&count, 1, &next);
+    Check(memcmp(first.grid, next.grid, sizeof(first.grid)) != 0,
+          "FieldCountUnrank neighbouring indices differ");
+
+    // --- Test 4: out-of-range indices are rejected ---
+    FieldInit(&next, NULL);
+    Check(FieldCountUnrank(&count, total, &next) == STANDARD_ERROR,
+          "FieldCountUnrank index out of range");
+
+    // --- Test 5: sampled fleets cover squares at the exact rates ---
+    uint32_t covered[FIELD_NUM_SQUARES] = {0};
+    const uint32_t samples = 20000;
+    Rng rng;
+    RngSeed(&rng, 7);
+    for (uint32_t i = 0; i < samples; i++) {
+        Field sample;
+        FieldInit(&sample, NULL);
+        FieldCountSample(&count, &sample, &rng);
+        FieldBitboard boats = FieldBitboardAndNot(FIELD_BITBOARD_ALL,
+                                                  FieldGetBitboard(&sample, FIELD_SQUARE_EMPTY));
+        while (boats) {
+            covered[FieldBitboardPopFirst(&boats)]++;
+        }
+    }
+    double worst = 0;
+    for (int i = 0; i < FIELD_NUM_SQUARES; i++) {
+        double diff = (double)covered[i] / samples - (double)exact.tally[i] / exact.total;
+        worst = diff > worst ? diff : (-diff > worst ? -diff : worst);
+    }
+    Check(worst < 0.02, "FieldCountSample matches exact coverage");
+
+    printf("FieldCount tests complete.\n");
+}
+
+// --------------------------- FIELD ENTROPY TEST ----------------------------
+
+/**
+ * Tests that FieldEntropy's bit-sliced sample counts match FieldSampler's,
+ * that its exact counts match FieldExact's, and that it sees sinkings coming.
+ */
+void TestFieldEntropy() {
+    Field opp;
+    FieldEntropy entropy;
+    FieldExact exact;
+    FieldSampler sampler;
+    FieldInit(NULL, &opp);
+
+    printf("Running FieldEntropy tests...\n");
+
+    // Two hits in the top-left corner with misses below: some boat lies
+    // east from the corner, and only the small one would sink at (0, 2)
+    GuessData shots[] = {
+        {0, 0, RESULT_HIT}, {0, 1, RESULT_HIT}, {1, 0, RESULT_MISS}, {1, 1, RESULT_MISS},
+    };
+    for (uint8_t i = 0; i < sizeof(shots) / sizeof(shots[0]); i++) {
+        FieldUpdateKnowledge(&opp, &shots[i]);
+    }
+    uint8_t next = FIELD_BITBOARD_INDEX(0, 2);
+
+    // --- Test 1: the same draws give the same coverage counts ---
+    uint64_t rng = 99;
+    FieldSamplerInit(&sampler, 99);
+    FieldSamplerRun(&sampler, &opp, 3000, 0);
+    FieldEntropySample(&entropy, &opp, &rng, 3000, 0);
+    bool same = entropy.total == sampler.samples && rng == sampler.rng;
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++) {
+        same = same && entropy.cover[i] == sampler.tally[i];
+    }
+    Check(same, "FieldEntropySample coverage matches FieldSamplerRun");
+
+    // --- Test 2: exact counts match FieldExact on every unknown square ---
+    FieldExactSolve(&exact, &opp);
+    FieldEntropyExact(&entropy, &opp, 0);
+    FieldBitboard unknown = FieldGetBitboard(&opp, FIELD_SQUARE_UNKNOWN);
+    same = entropy.total == exact.total;
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++) {
+        if (unknown & ((FieldBitboard)1 << i)) {
+            same = same && entropy.cover[i] == exact.tally[i];
+        }
+    }
+    Check(same, "FieldEntropyExact coverage matches FieldExact");
+
+    // --- Test 3: only the small boat can sink at (0, 2), and only there ---
+    bool sinks = entropy.sink[FIELD_BOAT_TYPE_SMALL][next] > 0 &&
+            entropy.sink[FIELD_BOAT_TYPE_SMALL][next] < entropy.cover[next];
+    for (uint8_t type = FIELD_BOAT_TYPE_MEDIUM; type < FIELD_NUM_BOATS; type++) {
+        sinks = sinks && entropy.sink[type][next] == 0;
+    }
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++) {
+        sinks = sinks && (i == next || entropy.sink[FIELD_BOAT_TYPE_SMALL][i] == 0);
+    }
+    Check(sinks, "FieldEntropyExact counts sinkings");
+
+    // --- Test 4: (0, 2) is a sure hit that may sink, so under one bit ---
+    uint32_t bits = FieldEntropyBits(&entropy, next);
+    FieldInit(NULL, &opp);
+    Check(entropy.cover[next] == entropy.total && bits > 0 && bits <= (1 << 12) &&
+          FieldEntropyExact(&entropy, &opp, 1) == 0,
+          "FieldEntropyBits");
+
+    // --- Test 5: a sampled guess depends only on the generator passed in ---
+    Rng a, b;
+    RngSeed(&a, 7);
+    RngSeed(&b, 7);
+    GuessData first = FieldEntropyDecideGuessRng(&opp, &a);
+    GuessData second = FieldEntropyDecideGuessRng(&opp, &b);
+    Check(first.row == second.row && first.col == second.col && RngNext(&a) == RngNext(&b),
+          "FieldEntropyDecideGuessRng is reproducible");
+
+    printf("FieldEntropy tests complete.\n");
+}
+
+// --------------------------- FIELD OPENING TEST ----------------------------
+
+/**
+ * Tests that the opening book agrees with the exact solver along a game and
+ * lets go of fields it does not cover.
+ */
+void TestFieldOpening() {
+    Field own, opp;
+    FieldExact exact;
+    GuessData guess, solved;
+    FieldInit(&own, &opp);
+    Rng rng;
+    RngSeed(&rng, 20);
+    FieldAIPlaceAllBoatsRng(&own, &rng);
+
+    printf("Running FieldOpening tests...\n");
+
+    // --- Test 1: every book move is the exact solver's move ---
+    uint8_t booked = 0;
+    bool agree = true;
+    while (FieldOpeningLookup(&opp, &guess) == SUCCESS) {
+        FieldExactSolve(&exact, &opp);
+        solved = FieldExactBestGuess(&exact, &opp);
+        agree = agree && guess.row == solved.row && guess.col == solved.col;
+        FieldRegisterEnemyAttack(&own, &guess);
+        FieldUpdateKnowledge(&opp, &guess);
+        booked++;
+    }
+    Check(agree && booked > 0 && booked <= FIELD_OPENING_DEPTH,
+          "FieldOpeningLookup matches FieldExactSolve");
+
+    // --- Test 2: a shot the book did not call for leaves the book ---
+    FieldInit(NULL, &opp);
+    guess.row = FIELD_BITBOARD_ROW(fieldOpeningBook[0]);
+    guess.col = (FIELD_BITBOARD_COL(fieldOpeningBook[0]) + 1) % FIELD_COLS;
+    guess.result = RESULT_MISS;
+    FieldUpdateKnowledge(&opp, &guess);
+    Check(FieldOpeningLookup(&opp, &solved) == STANDARD_ERROR, "FieldOpeningLookup off the book");
+
+    printf("FieldOpening tests complete.\n");
+}
+
+// ------------------------- FIELD AI DEADLINE TEST --------------------------
+
+/**
+ * Tests that FieldAIDecideGuessWithin honors its deadline and reports how far
+ * its search got.
+ */
+void TestFieldAIDecideGuessWithin() {
+    Field opp;
+    FieldAIState state;
+    FieldAIStats stats;
+    FieldInit(NULL, &opp);
+    FieldAIStateInit(&state);
+
+    printf("Running FieldAIDecideGuessWithin tests...\n");
+
+    // --- Test 1: a fresh field is answered from the opening book ---
+    GuessData guess = FieldAIDecideGuessWithin(&opp, &state, FieldAIMicros() - 1, &stats);
+    Check(stats.opening && stats.exact && stats.samples == 0 &&
+          FIELD_BITBOARD_INDEX(guess.row, guess.col) == fieldOpeningBook[0],
+          "FieldAIDecideGuessWithin plays the opening book");
+
+    // Leave the book with a shot it would not have made
+    GuessData offBook = { FIELD_ROWS - 1, FIELD_COLS - 1, RESULT_MISS };
+    if (FIELD_BITBOARD_INDEX(offBook.row, offBook.col) == fieldOpeningBook[0]) {
+        offBook.row = 0;
+    }
+    FieldUpdateKnowledge(&opp, &offBook);
+
+    // --- Test 2: a generous deadline solves the field exactly ---
+    guess = FieldAIDecideGuessWithin(&opp, &state, FieldAIMicros() + 2000000, &stats);
+    Check(stats.exact && !stats.opening && stats.placements > 0 && stats.samples == 0 &&
+          FieldGetSquareStatus(&opp, guess.row, guess.col) == FIELD_SQUARE_UNKNOWN,
+          "FieldAIDecideGuessWithin exact with time to spare");
+
+    // The rest runs on the fake clock
+    testClockStep = 50;
+
+    // --- Test 3: a tight deadline falls back to sampling and is honored ---
+    guess = FieldAIDecideGuessWithin(&opp, &state, FieldAIMicros() + 2000, &stats);
+    Check(!stats.exact && stats.samples > 0 && stats.elapsedMicros < 2500 &&
+          FieldGetSquareStatus(&opp, guess.row, guess.col) == FIELD_SQUARE_UNKNOWN,
+          "FieldAIDecideGuessWithin samples under a tight deadline");
+
+    // --- Test 4: a solver that overruns the deadline is still followed by
+    // sampling ---
+    guess = FieldAIDecideGuessWithin(&opp, &state, FieldAIMicros() + 4 * testClockStep, &stats);
+    Check(!stats.exact && stats.samples > 0 &&
+          FieldGetSquareStatus(&opp, guess.row, guess.col) == FIELD_SQUARE_UNKNOWN,
+          "FieldAIDecideGuessWithin samples after the solver overruns");
+
+    // --- Test 5: a passed deadline still returns a legal guess ---
+    guess = FieldAIDecideGuessWithin(&opp, NULL, FieldAIMicros() - 1, &stats);
+    Check(!stats.exact && stats.samples == 0 && stats.placements == 0 &&
+          FieldGetSquareStatus(&opp, guess.row, guess.col) == FIELD_SQUARE_UNKNOWN,
+          "FieldAIDecideGuessWithin with an expired deadline");
+
+    testClockStep = 0;
+
+    printf("FieldAIDecideGuessWithin tests complete.\n");
+}
+
+// -------------------------------- RNG TEST ---------------------------------
+
+/**
+ * Tests that Rng streams are reproducible, split into distinct streams and
+ * draw uniformly.
+ */
+void TestRng() {
+    Rng a, b, streamA, streamB;
+
+    printf("Running Rng tests...\n");
+
+    // --- Test 1: equal seeds give equal sequences ---
+    RngSeed(&a, 42);
+    RngSeed(&b, 42);
+    bool same = true;
+    for (int i = 0; i < 1000; i++) {
+        same = same && RngNext(&a) == RngNext(&b);
+    }
+    RngSeed(&b, 43);
+    Check(same && RngNext(&a) != RngNext(&b), "RngSeed reproducible");
+
+    // --- Test 2: split streams are reproducible and differ from the parent ---
+    RngSeed(&a, 1);
+    RngSeed(&b, 1);
+    RngSplit(&a, &streamA);
+    RngSplit(&b, &streamB);
+    uint64_t first = RngNext(&streamA);
+    Check(first == RngNext(&streamB) && RngNext(&a) == RngNext(&b) &&
+          RngNext(&a) != RngNext(&streamA), "RngSplit streams");
+
+    // --- Test 3: RngBelow stays in range and is close to uniform ---
+    uint32_t bins[6] = {0};
+    const uint32_t draws = 60000;
+    bool inRange = RngBelow(&a, 0) == 0 && RngBelow(&a, 1) == 0;
+    for (uint32_t i = 0; i < draws; i++) {
+        uint32_t r = RngBelow(&a, 6);
+        inRange = inRange && r < 6;
+        bins[r < 6 ? r : 0]++;
+    }
+    bool uniform = true;
+    for (int i = 0; i < 6; i++) {
+        uniform = uniform && bins[i] > draws / 6 * 95 / 100 && bins[i] < draws / 6 * 105 / 100;
+    }
+    Check(inRange && uniform, "RngBelow uniform in range");
+
+    // --- Test 4: mixed-in entropy changes the stream, in order ---
+    RngSeed(&a, 5);
+    RngSeed(&b, 5);
+    RngMix(&a, 100);
+    RngMix(&a, 200);
+    RngMix(&b, 200);
+    RngMix(&b, 100);
+    Check(RngNext(&a) != RngNext(&b), "RngMix order matters");
+
+    // --- Test 5: placement replays from a seed ---
+    Field fieldA, fieldB;
+    FieldInit(&fieldA, NULL);
+    FieldInit(&fieldB, NULL);
+    RngSeed(&a, 9);
+    RngSeed(&b, 9);
+    FieldAIPlaceAllBoatsRng(&fieldA, &a);
+    FieldAIPlaceAllBoatsRng(&fieldB, &b);
+    Check(memcmp(fieldA.grid, fieldB.grid, sizeof(fieldA.grid)) == 0,
+          "FieldAIPlaceAllBoatsRng reproducible");
+
+    printf("Rng tests complete.\n");
+}
+
+// ------------------------------ POLICY TEST --------------------------------
+
+static uint8_t testPolicyShots;
+
+static GuessData TestPolicyDecide(FieldPolicyState *state, const Field *oppField) {
+    (void)state;
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    uint8_t i = FieldBitboardPopFirst(&unknown);
+    GuessData guess = { i / FIELD_COLS, i % FIELD_COLS, RESULT_MISS };
+    return guess;
+}
+
+static void TestPolicyObserve(FieldPolicyState *state, const Field *oppField,
+                              const GuessData *ownGuess) {
+    (void)state;
+    (void)oppField;
+    (void)ownGuess;
+    testPolicyShots++;
+}
+
+static void TestPolicyReset(FieldPolicyState *state, const Field *oppField) {
+    (void)state;
+    (void)oppField;
+    testPolicyShots = 0;
+}
+
+static uint8_t TestPolicyPlace(FieldPolicyState *state, Field *ownField) {
+    return FieldAIPlaceAllBoatsRng(ownField, &state->rng);
+}
+
+static const FieldPolicy testPolicy = {
+    "scan", "fires in scan order",
+    TestPolicyPlace, TestPolicyDecide, TestPolicyObserve, TestPolicyReset, NULL
+};
+
+/**
+ * Plays one game with `policy` against a fleet placed by the same policy.
+ * Returns the number of shots, or 0 if it fired at a square twice or did not
+ * win within FIELD_NUM_SQUARES shots.
+ */
+static uint8_t PolicyShotsToWin(const FieldPolicy *policy, FieldPolicyState *state) {
+    Field own, opp;
+    FieldInit(&own, &opp);
+    policy->reset(state, &opp);
+    if (policy->place(state, &own) != SUCCESS) {
+        return 0;
+    }
+    uint8_t shots = 0;
+    while (FieldGetBoatStates(&own) && shots < FIELD_NUM_SQUARES) {
+        GuessData guess = policy->decide(state, &opp);
+        if (FieldGetSquareStatus(&opp, guess.row, guess.col) != FIELD_SQUARE_UNKNOWN) {
+            return 0;
+        }
+        FieldRegisterEnemyAttack(&own, &guess);
+        FieldUpdateKnowledge(&opp, &guess);
+        policy->observe(state, &opp, &guess);
+        shots++;
+    }
+    return FieldGetBoatStates(&own) ? 0 : shots;
+}
+
+/**
+ * Tests the policy registry and plays a game with every registered policy.
+ */
+void TestFieldPolicy() {
+    FieldPolicyState state;
+    Rng rng;
+    RngSeed(&rng, 3);
+
+    printf("Running FieldPolicy tests...\n");
+
+    // --- Test 1: built-ins are found by name, unknown names are not ---
+    uint8_t builtins = FieldPolicyCount();
+    Check(FieldPolicyFind(FIELD_POLICY_AGENT_DEFAULT) != NULL &&
+          FieldPolicyFind("density") == FieldPolicyGet(1) &&
+          FieldPolicyFind("nonesuch") == NULL && FieldPolicyGet(builtins) == NULL,
+          "FieldPolicyFind built-ins");
+
+    // --- Test 2: a new policy registers once ---
+    FieldPolicy incomplete = testPolicy;
+    incomplete.name = "incomplete";
+    incomplete.decide = NULL;
+    Check(FieldPolicyRegister(&testPolicy) == SUCCESS &&
+          FieldPolicyRegister(&testPolicy) == STANDARD_ERROR &&
+          FieldPolicyRegister(&incomplete) == STANDARD_ERROR &&
+          FieldPolicyCount() == builtins + 1 && FieldPolicyFind("scan") == &testPolicy,
+          "FieldPolicyRegister");
+
+    // --- Test 3: every policy wins a game without repeating a shot ---
+    bool allWin = true;
+    for (uint8_t i = 0; i < FieldPolicyCount(); i++) {
+        const FieldPolicy *policy = FieldPolicyGet(i);
+        FieldPolicyStateInit(&state, &rng);
+        state.samples = 200;
+        state.budgetMicros = 0;
+        state.deadlineMicros = 2000;
+        uint8_t shots = PolicyShotsToWin(policy, &state);
+        if (shots == 0) {
+            printf("  %s: %u shots\n", policy->name, shots);
+            allWin = false;
+        }
+    }
+    Check(allWin && testPolicyShots > 0, "every policy plays a legal game");
+
+    printf("FieldPolicy tests complete.\n");
+}
+
+// ---------------------------- FIELD OPPONENT TEST ---------------------------
+
+/**
+ * Returns the index in fieldPlacements of a boat placement.
+ */
+static uint16_t PlacementIndex(uint8_t row, uint8_t col, BoatDirection dir, BoatType type) {
+    for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++) {
+        if (fieldPlacements[p].row == row && fieldPlacements[p].col == col &&
+            fieldPlacements[p].dir == dir) {
+            return p;
+        }
+    }
+    return FIELD_NUM_PLACEMENTS;
+}
+
+/**
+ * Tests that FieldOpponent learns sunk placements, steers the hunt towards
+ * them and survives a round trip through a file.
+ */
+void TestFieldOpponent() {
+    FieldOpponent model, loaded;
+    FieldAIState state;
+    Field own, opp;
+    const char *path = "FieldAI_test.bbom";
+
+    printf("Running FieldOpponent tests...\n");
+
+    // A fixed fleet: boats along the top and left edges
+    FieldInit(&own, &opp);
+    FieldAddBoat(&own, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE);
+    FieldAddBoat(&own, 1, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE);
+    FieldAddBoat(&own, 5, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM);
+    FieldAddBoat(&own, 2, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL);
+    Field layout = own;
+    uint16_t huge = PlacementIndex(0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE);
+
+    // --- Test 1: an empty model hunts exactly like density ---
+    FieldOpponentInit(&model, 7);
+    bool same = FieldOpponentScale(&model, huge) == (1 << FIELD_OPPONENT_SCALE_BITS);
+    FieldAIStateInit(&state);
+    while (FieldGetBoatStates(&own)) {
+        GuessData guess = FieldDensityDecideGuess(&opp);
+        GuessData modelGuess = FieldOpponentDecideGuess(&model, &opp);
+        same = same && guess.row == modelGuess.row && guess.col == modelGuess.col;
+        FieldRegisterEnemyAttack(&own, &guess);
+        FieldUpdateKnowledge(&opp, &guess);
+        FieldAIStateUpdate(&state, &guess);
+    }
+    Check(same && FieldOpponentCheck(&model) == SUCCESS, "empty FieldOpponent matches density");
+
+    // --- Test 2: a finished game raises the sunk placements above average ---
+    uint8_t learned = FieldOpponentLearn(&model, &opp, &state);
+    uint16_t other = PlacementIndex(3, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE);
+    Check(learned == FIELD_NUM_BOATS && model.games == 1 &&
+          FieldOpponentScale(&model, huge) > (1 << FIELD_OPPONENT_SCALE_BITS) &&
+          FieldOpponentScale(&model, other) < (1 << FIELD_OPPONENT_SCALE_BITS),
+          "FieldOpponentLearn counts sunk boats");
+
+    // --- Test 3: after a few games the first shot lands on the fleet ---
+    for (uint8_t g = 0; g < 8; g++) {
+        FieldOpponentLearn(&model, &opp, &state);
+    }
+    FieldInit(NULL, &opp);
+    GuessData first = FieldOpponentDecideGuess(&model, &opp);
+    Check(FieldGetSquareStatus(&layout, first.row, first.col) != FIELD_SQUARE_EMPTY,
+          "FieldOpponentDecideGuess follows the prior");
+
+    // --- Test 4: saving and loading round-trips; damage is detected ---
+    bool roundTrip = FieldOpponentSave(&model, path) == SUCCESS &&
+            FieldOpponentLoad(&loaded, path) == SUCCESS &&
+            memcmp(&loaded, &model, sizeof(model)) == 0;
+    loaded.count[huge]++;
+    bool damaged = FieldOpponentCheck(&loaded) == STANDARD_ERROR;
+    loaded = model;
+    loaded.magic = 0;
+    damaged = damaged && FieldOpponentCheck(&loaded) == STANDARD_ERROR;
+    remove(path);
+    Check(roundTrip && damaged && FieldOpponentLoad(&loaded, path) == STANDARD_ERROR,
+          "FieldOpponentSave and FieldOpponentLoad");
+
+    // --- Test 5: nothing sunk teaches nothing; a full count halves them all ---
+    model.count[huge] = UINT16_MAX - 1;
+    uint16_t before = model.count[other];
+    FieldOpponentLearn(&model, &opp, NULL);
+    Check(model.count[huge] > UINT16_MAX / 2 && model.count[other] == before,
+          "FieldOpponentLearn ignores a game with nothing sunk");
+    opp = layout;
+    for (uint8_t r = 0; r < FIELD_ROWS; r++) {
+        for (uint8_t c = 0; c < FIELD_COLS; c++) {
+            GuessData guess = { r, c, RESULT_MISS };
+            FieldRegisterEnemyAttack(&opp, &guess);
+        }
+    }
+    FieldOpponentLearn(&model, &opp, NULL);
+    Check(model.count[huge] < UINT16_MAX / 2 + FIELD_OPPONENT_UNIT && model.count[huge] > 0,
+          "FieldOpponentLearn halves a full model");
+
+    printf("FieldOpponent tests complete.\n");
+}
+
+// ---------------------------- FIELD CACHE TEST ------------------------------
+
+/**
+ * Tests FieldCache lookups, replacement and its seqlock, and that the
+ * "exact" policy answers from it.
+ */
+void TestFieldCache() {
+    FieldCacheSlot slots[4];
+    FieldCacheEntry entry, found;
+    FieldCacheStats stats;
+    FieldCache cache;
+    Field opp, other;
+    GuessData miss = {0, 0, RESULT_MISS};
+    GuessData hit = {3, 3, RESULT_HIT};
+
+    printf("Running FieldCache tests...\n");
+
+    memset(&stats, 0, sizeof(stats));
+    memset(&entry, 0, sizeof(entry));
+    entry.square = FIELD_BITBOARD_INDEX(2, 5);
+    entry.prob[entry.square] = 200;
+    FieldInit(NULL, &opp);
+    FieldUpdateKnowledge(&opp, &miss);
+    uint64_t key = FieldCacheKey(&opp, FIELD_CACHE_EXACT);
+
+    // --- Test 1: only a power of two; a fresh cache misses ---
+    Check(FieldCacheInit(&cache, slots, 3) == STANDARD_ERROR &&
+          FieldCacheInit(&cache, slots, 4) == SUCCESS &&
+          FieldCacheLookup(&cache, key, &found, &stats) == STANDARD_ERROR,
+          "FieldCacheInit");
+
+    // --- Test 2: a stored entry comes back, for that analysis only ---
+    FieldCacheStore(&cache, key, &entry, &stats);
+    bool same = FieldCacheLookup(&cache, key, &found, &stats) == SUCCESS &&
+            found.prob[entry.square] == 200;
+    GuessData guess = FieldCacheGuess(&found);
+    Check(same && guess.row == 2 && guess.col == 5 &&
+          FieldCacheLookup(&cache, FieldCacheKey(&opp, FIELD_CACHE_ENTROPY), &found, NULL) ==
+          STANDARD_ERROR,
+          "FieldCacheStore and FieldCacheLookup");
+
+    // --- Test 3: an entry with a store under way reads as a miss ---
+    atomic_fetch_add(&slots[key & 3].seq, 1);
+    bool writing = FieldCacheLookup(&cache, key, &found, &stats) == STANDARD_ERROR;
+    FieldCacheStore(&cache, key, &entry, &stats);
+    atomic_fetch_add(&slots[key & 3].seq, 1);
+    Check(writing && FieldCacheLookup(&cache, key, &found, &stats) == SUCCESS,
+          "FieldCacheLookup skips a slot being written");
+
+    // --- Test 4: another state in the same slot evicts it ---
+    FieldCacheStore(&cache, key, &entry, &stats);
+    uint32_t evictions = stats.evictions;
+    uint64_t otherKey = key;
+    for (uint8_t i = 1; i < FIELD_NUM_SQUARES && otherKey == key; i++) {
+        GuessData shot = {FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i), RESULT_MISS};
+        other = opp;
+        FieldUpdateKnowledge(&other, &shot);
+        if ((FieldCacheKey(&other, FIELD_CACHE_EXACT) & 3) == (key & 3)) {
+            otherKey = FieldCacheKey(&other, FIELD_CACHE_EXACT);
+        }
+    }
+    FieldCacheStore(&cache, otherKey, &entry, &stats);
+    Check(otherKey != key && stats.evictions == evictions + 1 &&
+          FieldCacheLookup(&cache, key, &found, &stats) == STANDARD_ERROR &&
+          stats.lookups == 5 && stats.hits == 2 && stats.stores == 4,
+          "FieldCacheStore replaces and counts");
+
+    // --- Test 5: the exact policy stores its analysis and reuses it ---
+    const FieldPolicy *exact = FieldPolicyFind("exact");
+    FieldPolicyState state;
+    FieldCacheSlot policySlots[64];
+    Rng rng;
+    RngSeed(&rng, 5);
+    FieldPolicyStateInit(&state, &rng);
+    FieldCacheInit(&cache, policySlots, 64);
+    state.cache = &cache;
+    FieldInit(NULL, &opp);
+    for (uint8_t col = 0; col < FIELD_COLS; col += 2) {
+        miss.row = 5;
+        miss.col = col;
+        FieldUpdateKnowledge(&opp, &miss);
+    }
+    FieldUpdateKnowledge(&opp, &hit);
+    exact->reset(&state, &opp);
+    GuessData first = exact->decide(&state, &opp);
+    GuessData second = exact->decide(&state, &opp);
+    Check(state.cacheStats.stores == 1 && state.cacheStats.hits == 1 &&
+          first.row == second.row && first.col == second.col &&
+          FieldCacheLookup(&cache, FieldCacheKey(&opp, FIELD_CACHE_EXACT), &found, NULL) ==
+          SUCCESS && found.prob[FIELD_BITBOARD_INDEX(3, 3)] == 255,
+          "exact policy answers from the cache");
+
+    printf("FieldCache tests complete.\n");
+}
+
+// ------------------------------ MAIN FUNCTION -------------------------------
+
+/**
+ * Main test entry point.
+ */
+int main(void) {
+    BOARD_Init();
+
+    printf("\n=== Field AI Tests ===\n\n");
+
+    TestRng();
+    TestFieldSampler();
+    TestFieldSamplerParallel();
+    TestFieldExact();
+    TestFieldCount();
+    TestFieldDensityMap();
+    TestFieldEntropy();
+    TestFieldOpening();
+    TestFieldAIDecideGuessWithin();
+    TestFieldPolicy();
+    TestFieldOpponent();
+    TestFieldCache();
+
+    printf("\n=== Field AI Tests %s ===\n", allTestsPassed ? "PASSED" : "FAILED");
+
+    return allTestsPassed ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file    FieldAttribution.c
+ *
+ * Works out which hit squares belonged to the boats that have been sunk.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldAttribution.h"
+#include "FieldPlacement.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+/**
+ * Working state for one attribution.
+ */
+typedef struct {
+    FieldBitboard hits;
+    FieldBitboard misses;
+    const uint8_t *sunkSquare;
+    const FieldBitboard *hitsAtSink;
+    uint8_t sunk[FIELD_NUM_BOATS];      // Sunk BoatTypes
+    uint8_t numSunk;
+    uint8_t alive;                      // FIELD_BOAT_STATUS_* of boats afloat
+    uint8_t found;                      // Nonzero once an assignment is kept
+    FieldBitboard dead;                 // Intersection of kept assignments
+    FieldBitboard possible;             // Union of kept assignments
+} FieldAttribution;
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldAttributionLegal(*a, mask, occupied)
+ *
+ * Whether a boat still afloat may take `mask`: it avoids misses and other
+ * boats, and it has not been hit everywhere (or it would have sunk).
+ */
+static uint8_t FieldAttributionLegal(const FieldAttribution *a, FieldBitboard mask,
+                                     FieldBitboard occupied)
+{
+    return mask && !FieldBitboardAnd(mask, a->misses | occupied) &&
+           FieldBitboardAndNot(mask, a->hits);
+}
+
+/** FieldAttributionFit(*a, placed, occupied)
+ *
+ * Whether the boats afloat that are not yet placed all fit somewhere.
+ */
+static uint8_t FieldAttributionFit(const FieldAttribution *a, uint8_t placed,
+                                   FieldBitboard occupied)
+{
+    uint8_t todo = a->alive & ~placed;
+    if (!todo)
+    {
+        return 1;
+    }
+    uint8_t type = __builtin_ctz(todo);
+
+    for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+    {
+        FieldBitboard mask = fieldPlacements[p].mask;
+        if (FieldAttributionLegal(a, mask, occupied) &&
+            FieldAttributionFit(a, placed | (1 << type), occupied | mask))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/** FieldAttributionCover(*a, placed, occupied, uncovered)
+ *
+ * Whether the boats afloat can cover every square of `uncovered`. Branches
+ * only on placements through the lowest uncovered square, which some boat has
+ * to cover.
+ */
+static uint8_t FieldAttributionCover(const FieldAttribution *a, uint8_t placed,
+                                     FieldBitboard occupied, FieldBitboard uncovered)
+{
+    if (!uncovered)
+    {
+        return FieldAttributionFit(a, placed, occupied);
+    }
+
+    uint8_t square = FieldBitboardFirst(uncovered);
+    uint8_t row = FIELD_BITBOARD_ROW(square);
+    uint8_t col = FIELD_BITBOARD_COL(square);
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(a->alive & ~placed & (1 << type)))
+        {
+            continue;
+        }
+        for (uint8_t back = 0; back < fieldBoatSizes[type]; back++)
+        {
+            FieldBitboard masks[2] = {0, 0};
+            if (row >= back)
+            {
+                masks[FIELD_DIR_SOUTH] = fieldPlacementMasks[type][row - back][col][FIELD_DIR_SOUTH];
+            }
+            if (col >= back)
+            {
+                masks[FIELD_DIR_EAST] = fieldPlacementMasks[type][row][col - back][FIELD_DIR_EAST];
+            }
+
+            for (uint8_t dir = 0; dir < 2; dir++)
+            {
+                FieldBitboard mask = masks[dir];
+                if (FieldAttributionLegal(a, mask, occupied) &&
+                    FieldAttributionCover(a, placed | (1 << type), occupied | mask,
+                                          FieldBitboardAndNot(uncovered, mask)))
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/** FieldAttributionAssign(*a, level, occupied)
+ *
+ * Places sunk boats from `level` on, and records every complete assignment
+ * that leaves a coverable set of hits for the boats afloat.
+ */
+static void FieldAttributionAssign(FieldAttribution *a, uint8_t level, FieldBitboard occupied)
+{
+    if (level == a->numSunk)
+    {
+        if (FieldAttributionCover(a, 0, occupied, FieldBitboardAndNot(a->hits, occupied)))
+        {
+            a->dead = a->found ? FieldBitboardAnd(a->dead, occupied) : occupied;
+            a->possible |= occupied;
+            a->found = 1;
+        }
+        return;
+    }
+
+    uint8_t type = a->sunk[level];
+    FieldBitboard allowed = FieldBitboardAnd(a->hits, a->hitsAtSink[type]);
+    FieldBitboard required = 0;
+    if (a->sunkSquare[type] < FIELD_NUM_SQUARES)
+    {
+        required = (FieldBitboard)1 << a->sunkSquare[type];
+    }
+
+    for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+    {
+        FieldBitboard mask = fieldPlacements[p].mask;
+        if (FieldBitboardAndNot(mask, allowed) || FieldBitboardAndNot(required, mask) ||
+            FieldBitboardAnd(mask, occupied))
+        {
+            continue;
+        }
+        FieldAttributionAssign(a, level + 1, occupied | mask);
+    }
+}
+
+/*  PROTOTYPES  */
+
+/** FieldAttributeSunk(*oppField, sunkSquare, hitsAtSink, *possible)
+ *
+ * Assigns the hits on oppField to the sunk boats.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   sunkSquare  Per BoatType, the square of the sinking shot, or
+ *                      FIELD_NUM_SQUARES if unknown.
+ * @param   hitsAtSink  Per BoatType, the hits known when that boat sank.
+ * @param   *possible   If not NULL, receives the hits that may belong to a
+ *                      sunk boat.
+ * @return  The hits that belong to a sunk boat in every assignment.
+ */
+FieldBitboard FieldAttributeSunk(const Field *oppField,
+                                 const uint8_t sunkSquare[FIELD_NUM_BOATS],
+                                 const FieldBitboard hitsAtSink[FIELD_NUM_BOATS],
+                                 FieldBitboard *possible)
+{
+    FieldAttribution a;
+    a.hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    a.misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    a.sunkSquare = sunkSquare;
+    a.hitsAtSink = hitsAtSink;
+    a.alive = FieldGetBoatStates(oppField);
+    a.numSunk = 0;
+    a.found = 0;
+    a.dead = 0;
+    a.possible = 0;
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(a.alive & (1 << type)))
+        {
+            a.sunk[a.numSunk++] = type;
+        }
+    }
+
+    if (a.numSunk > 0)
+    {
+        FieldAttributionAssign(&a, 0, 0);
+    }
+    if (possible != NULL)
+    {
+        *possible = a.possible;
+    }
+    return a.dead;
+}
@@ -0,0 +1,680 @@
+/**
+ * @file    FieldBoard.c
+ *
+ * Boards and fleets chosen at runtime, for variant games.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldBoard.h"
+#include "FieldDensity.h"
+#include "Rng.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// Hits past this many no longer raise a placement's weight, so that long
+// boats cannot overflow the density map
+#define FIELD_BOARD_MAX_WEIGHTED_HITS 8
+
+const FieldRules fieldRulesStandard = {
+    FIELD_ROWS, FIELD_COLS, FIELD_NUM_BOATS,
+    {FIELD_BOAT_SIZE_SMALL, FIELD_BOAT_SIZE_MEDIUM, FIELD_BOAT_SIZE_LARGE, FIELD_BOAT_SIZE_HUGE},
+    {1, 1, 1, 1}};
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldBoardRun(n)
+ *
+ * A row with the low n bits set, for n up to 64.
+ */
+static FieldBoardRow FieldBoardRun(uint8_t n)
+{
+    return (n >= 64) ? ~(FieldBoardRow)0 : ((FieldBoardRow)1 << n) - 1;
+}
+
+/** FieldBoardCount(r)
+ *
+ * The number of columns in r.
+ */
+static uint8_t FieldBoardCount(FieldBoardRow r)
+{
+    return (uint8_t)__builtin_popcountll(r);
+}
+
+/** FieldBoardStartsEast(free, size, cols)
+ *
+ * The columns where a horizontal boat of `size` starts and covers only
+ * columns of `free`: a run of `size` set bits, found by ANDing shifted copies.
+ */
+static FieldBoardRow FieldBoardStartsEast(FieldBoardRow free, uint8_t size, uint8_t cols)
+{
+    if (size > cols)
+    {
+        return 0;
+    }
+    FieldBoardRow starts = free;
+    for (uint8_t i = 1; i < size; i++)
+    {
+        starts &= free >> i;
+    }
+    return starts & FieldBoardRun(cols - size + 1);
+}
+
+/** FieldBoardStartsSouth(free, row, size)
+ *
+ * The columns where a vertical boat of `size` starts at `row` and covers only
+ * squares of `free`: the AND of the rows it spans. The caller keeps the boat
+ * on the board.
+ */
+static FieldBoardRow FieldBoardStartsSouth(const FieldBoardRow free[], uint8_t row, uint8_t size)
+{
+    FieldBoardRow starts = free[row];
+    for (uint8_t i = 1; i < size; i++)
+    {
+        starts &= free[row + i];
+    }
+    return starts;
+}
+
+/** FieldBoardFreeRows(*b, free)
+ *
+ * The squares of each row that hold nothing: no boat, hit or miss.
+ */
+static void FieldBoardFreeRows(const FieldBoard *b, FieldBoardRow free[FIELD_BOARD_MAX_ROWS])
+{
+    FieldBoardRow cols = FieldBoardRun(b->rules->cols);
+    for (uint8_t row = 0; row < b->rules->rows; row++)
+    {
+        free[row] = ~(b->boats[row] | b->hit[row] | b->miss[row]) & cols;
+    }
+}
+
+/** FieldBoardBoatAt(*b, row, col)
+ *
+ * The afloat boat that covers (row, col), or FIELD_BOARD_NO_BOAT.
+ */
+static uint8_t FieldBoardBoatAt(const FieldBoard *b, uint8_t row, uint8_t col)
+{
+    for (uint8_t boat = 0; boat < b->numBoats; boat++)
+    {
+        if (!(b->afloat & (1u << boat)))
+        {
+            continue;
+        }
+        uint8_t size = b->rules->size[b->boatType[boat]];
+        uint8_t along = (b->boatDir[boat] == FIELD_DIR_SOUTH) ? row : col;
+        uint8_t across = (b->boatDir[boat] == FIELD_DIR_SOUTH) ? col : row;
+        uint8_t start = (b->boatDir[boat] == FIELD_DIR_SOUTH) ? b->boatRow[boat] : b->boatCol[boat];
+        uint8_t line = (b->boatDir[boat] == FIELD_DIR_SOUTH) ? b->boatCol[boat] : b->boatRow[boat];
+        if (across == line && along >= start && along < start + size)
+        {
+            return boat;
+        }
+    }
+    return FIELD_BOARD_NO_BOAT;
+}
+
+/*  PROTOTYPES  */
+
+/** FieldRulesCheck(*rules)
+ *
+ * @param   *rules  The rules to check.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldRulesCheck(const FieldRules *rules)
+{
+    if (rules->rows == 0 || rules->rows > FIELD_BOARD_MAX_ROWS ||
+        rules->cols == 0 || rules->cols > FIELD_BOARD_MAX_COLS ||
+        rules->numTypes == 0 || rules->numTypes > FIELD_BOARD_MAX_TYPES)
+    {
+        return STANDARD_ERROR;
+    }
+
+    uint16_t boats = 0;
+    uint32_t squares = 0;
+    uint8_t longest = rules->rows > rules->cols ? rules->rows : rules->cols;
+    for (uint8_t t = 0; t < rules->numTypes; t++)
+    {
+        if (rules->size[t] == 0 || rules->size[t] > longest)
+        {
+            return STANDARD_ERROR;
+        }
+        boats += rules->count[t];
+        squares += (uint32_t)rules->size[t] * rules->count[t];
+    }
+    if (boats == 0 || boats > FIELD_BOARD_MAX_BOATS ||
+        squares > (uint32_t)rules->rows * rules->cols)
+    {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/** FieldRulesIsStandard(*rules)
+ *
+ * @param   *rules  The rules to check.
+ * @return  Nonzero if the rules are the game Field implements.
+ */
+uint8_t FieldRulesIsStandard(const FieldRules *rules)
+{
+    if (rules->rows != fieldRulesStandard.rows || rules->cols != fieldRulesStandard.cols ||
+        rules->numTypes != fieldRulesStandard.numTypes)
+    {
+        return 0;
+    }
+    for (uint8_t t = 0; t < rules->numTypes; t++)
+    {
+        if (rules->size[t] != fieldRulesStandard.size[t] ||
+            rules->count[t] != fieldRulesStandard.count[t])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** FieldBoardInit(*ownBoard, *oppBoard, *rules)
+ *
+ * Clears both boards.
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @param   *rules      Rules that pass FieldRulesCheck().
+ */
+void FieldBoardInit(FieldBoard *ownBoard, FieldBoard *oppBoard, const FieldRules *rules)
+{
+    FieldBoard *boards[2] = {ownBoard, oppBoard};
+
+    for (uint8_t side = 0; side < 2; side++)
+    {
+        FieldBoard *b = boards[side];
+        if (b == NULL)
+        {
+            continue;
+        }
+        b->rules = rules;
+        b->opponent = side;
+        b->numBoats = 0;
+        for (uint8_t t = 0; t < rules->numTypes; t++)
+        {
+            for (uint8_t k = 0; k < rules->count[t]; k++)
+            {
+                b->boatType[b->numBoats] = t;
+                b->lives[b->numBoats] = (side == 0) ? 0 : rules->size[t];
+                b->numBoats++;
+            }
+        }
+        b->afloat = (side == 0) ? 0 : (uint32_t)(((uint64_t)1 << b->numBoats) - 1);
+
+        for (uint8_t row = 0; row < FIELD_BOARD_MAX_ROWS; row++)
+        {
+            b->boats[row] = 0;
+            b->hit[row] = 0;
+            b->miss[row] = 0;
+        }
+    }
+}
+
+/** FieldBoardGetSquare(*b, row, col)
+ *
+ * @param   *b      The board.
+ * @param   row     The row.
+ * @param   col     The column.
+ * @return  The square's value, or FIELD_BOARD_NO_BOAT if out of bounds.
+ */
+uint8_t FieldBoardGetSquare(const FieldBoard *b, uint8_t row, uint8_t col)
+{
+    if (row >= b->rules->rows || col >= b->rules->cols)
+    {
+        return FIELD_BOARD_NO_BOAT;
+    }
+    FieldBoardRow bit = (FieldBoardRow)1 << col;
+    if (b->hit[row] & bit)
+    {
+        return FIELD_BOARD_HIT;
+    }
+    if (b->miss[row] & bit)
+    {
+        return FIELD_BOARD_MISS;
+    }
+    if (b->boats[row] & bit)
+    {
+        return FIELD_BOARD_BOAT(FieldBoardBoatAt(b, row, col));
+    }
+    return b->opponent ? FIELD_BOARD_UNKNOWN : FIELD_BOARD_EMPTY;
+}
+
+/** FieldBoardSetSquare(*b, row, col, square)
+ *
+ * Sets one square that holds no boat.
+ *
+ * @param   *b      The board.
+ * @param   row     The row.
+ * @param   col     The column.
+ * @param   square  The new value.
+ * @return  The old value, or FIELD_BOARD_NO_BOAT if nothing was set.
+ */
+uint8_t FieldBoardSetSquare(FieldBoard *b, uint8_t row, uint8_t col, uint8_t square)
+{
+    uint8_t old = FieldBoardGetSquare(b, row, col);
+    if (old == FIELD_BOARD_NO_BOAT || (b->boats[row] & ((FieldBoardRow)1 << col)) ||
+        (square != FIELD_BOARD_EMPTY && square != FIELD_BOARD_UNKNOWN &&
+         square != FIELD_BOARD_HIT && square != FIELD_BOARD_MISS))
+    {
+        return FIELD_BOARD_NO_BOAT;
+    }
+
+    FieldBoardRow bit = (FieldBoardRow)1 << col;
+    b->hit[row] &= ~bit;
+    b->miss[row] &= ~bit;
+    if (square == FIELD_BOARD_HIT)
+    {
+        b->hit[row] |= bit;
+    }
+    else if (square == FIELD_BOARD_MISS)
+    {
+        b->miss[row] |= bit;
+    }
+    return old;
+}
+
+/** FieldBoardGetRow(*b, square, row)
+ *
+ * @param   *b      The board.
+ * @param   square  The kind of square.
+ * @param   row     The row.
+ * @return  The columns of `row` that hold `square`.
+ */
+FieldBoardRow FieldBoardGetRow(const FieldBoard *b, uint8_t square, uint8_t row)
+{
+    if (row >= b->rules->rows)
+    {
+        return 0;
+    }
+    FieldBoardRow cols = FieldBoardRun(b->rules->cols);
+    FieldBoardRow blank = ~(b->boats[row] | b->hit[row] | b->miss[row]) & cols;
+
+    switch (square)
+    {
+    case FIELD_BOARD_EMPTY:
+        return b->opponent ? 0 : blank;
+    case FIELD_BOARD_UNKNOWN:
+        return b->opponent ? blank : 0;
+    case FIELD_BOARD_HIT:
+        return b->hit[row];
+    case FIELD_BOARD_MISS:
+        return b->miss[row];
+    default:
+        return (square <= FIELD_BOARD_BOAT(FIELD_BOARD_MAX_BOATS - 1)) ? b->boats[row] : 0;
+    }
+}
+
+/** FieldBoardAddBoat(*ownBoard, row, col, dir, boat)
+ *
+ * Places boat number `boat` with its top-left end at (row, col).
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   row, col    The top-left end of the boat.
+ * @param   dir         FIELD_DIR_SOUTH or FIELD_DIR_EAST.
+ * @param   boat        The boat, numbered as in FieldRules.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldBoardAddBoat(FieldBoard *ownBoard, uint8_t row, uint8_t col,
+                          BoatDirection dir, uint8_t boat)
+{
+    const FieldRules *rules = ownBoard->rules;
+    if (boat >= ownBoard->numBoats || (ownBoard->afloat & (1u << boat)) ||
+        row >= rules->rows || col >= rules->cols)
+    {
+        return STANDARD_ERROR;
+    }
+    uint8_t size = rules->size[ownBoard->boatType[boat]];
+    FieldBoardRow free[FIELD_BOARD_MAX_ROWS];
+    FieldBoardFreeRows(ownBoard, free);
+
+    FieldBoardRow bit = (FieldBoardRow)1 << col;
+    if (dir == FIELD_DIR_SOUTH)
+    {
+        if (row + size > rules->rows || !(FieldBoardStartsSouth(free, row, size) & bit))
+        {
+            return STANDARD_ERROR;
+        }
+        for (uint8_t i = 0; i < size; i++)
+        {
+            ownBoard->boats[row + i] |= bit;
+        }
+    }
+    else
+    {
+        if (!(FieldBoardStartsEast(free[row], size, rules->cols) & bit))
+        {
+            return STANDARD_ERROR;
+        }
+        ownBoard->boats[row] |= FieldBoardRun(size) << col;
+    }
+
+    ownBoard->boatRow[boat] = row;
+    ownBoard->boatCol[boat] = col;
+    ownBoard->boatDir[boat] = dir;
+    ownBoard->lives[boat] = size;
+    ownBoard->afloat |= 1u << boat;
+    return SUCCESS;
+}
+
+/** FieldBoardPlaceAllBoats(*ownBoard, *rng)
+ *
+ * Places the whole fleet at random, longest boats first.
+ *
+ * @param   *ownBoard   A board with no boats yet.
+ * @param   *rng        The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if some boat had no room left.
+ */
+uint8_t FieldBoardPlaceAllBoats(FieldBoard *ownBoard, Rng *rng)
+{
+    const FieldRules *rules = ownBoard->rules;
+    FieldBoardRow free[FIELD_BOARD_MAX_ROWS];
+    uint32_t placed = 0;
+
+    for (uint8_t n = 0; n < ownBoard->numBoats; n++)
+    {
+        // The longest boat not yet placed
+        uint8_t boat = FIELD_BOARD_NO_BOAT;
+        for (uint8_t b = 0; b < ownBoard->numBoats; b++)
+        {
+            if (!(placed & (1u << b)) &&
+                (boat == FIELD_BOARD_NO_BOAT ||
+                 rules->size[ownBoard->boatType[b]] > rules->size[ownBoard->boatType[boat]]))
+            {
+                boat = b;
+            }
+        }
+        placed |= 1u << boat;
+        uint8_t size = rules->size[ownBoard->boatType[boat]];
+
+        // Count the free positions a row at a time, then find a random one
+        FieldBoardFreeRows(ownBoard, free);
+        uint32_t total = 0;
+        for (uint8_t row = 0; row < rules->rows; row++)
+        {
+            total += FieldBoardCount(FieldBoardStartsEast(free[row], size, rules->cols));
+            if (row + size <= rules->rows)
+            {
+                total += FieldBoardCount(FieldBoardStartsSouth(free, row, size));
+            }
+        }
+        if (total == 0)
+        {
+            return STANDARD_ERROR;
+        }
+
+        uint32_t pick = RngBelow(rng, total);
+        for (uint8_t row = 0; row < rules->rows; row++)
+        {
+            FieldBoardRow starts[2];
+            starts[FIELD_DIR_EAST] = FieldBoardStartsEast(free[row], size, rules->cols);
+            starts[FIELD_DIR_SOUTH] = (row + size <= rules->rows) ?
+                                      FieldBoardStartsSouth(free, row, size) : 0;
+            for (uint8_t dir = 0; dir < 2; dir++)
+            {
+                uint8_t here = FieldBoardCount(starts[dir]);
+                if (pick >= here)
+                {
+                    pick -= here;
+                    continue;
+                }
+                while (pick--)
+                {
+                    starts[dir] &= starts[dir] - 1;
+                }
+                FieldBoardAddBoat(ownBoard, row, (uint8_t)__builtin_ctzll(starts[dir]), dir, boat);
+                row = rules->rows;
+                break;
+            }
+        }
+    }
+    return SUCCESS;
+}
+
+/** FieldBoardRegisterAttack(*ownBoard, *guess)
+ *
+ * Applies an opponent's shot.
+ *
+ * @param   *ownBoard   The player's board.
+ * @param   *guess      The shot.
+ * @return  The boat that this shot sank, or FIELD_BOARD_NO_BOAT.
+ */
+uint8_t FieldBoardRegisterAttack(FieldBoard *ownBoard, GuessData *guess)
+{
+    guess->result = RESULT_MISS;
+    if (guess->row >= ownBoard->rules->rows || guess->col >= ownBoard->rules->cols)
+    {
+        return FIELD_BOARD_NO_BOAT;
+    }
+
+    FieldBoardRow bit = (FieldBoardRow)1 << guess->col;
+    if (ownBoard->hit[guess->row] & bit)
+    {
+        guess->result = RESULT_HIT;
+        return FIELD_BOARD_NO_BOAT;
+    }
+    if (!(ownBoard->boats[guess->row] & bit))
+    {
+        ownBoard->miss[guess->row] |= bit;
+        return FIELD_BOARD_NO_BOAT;
+    }
+
+    uint8_t boat = FieldBoardBoatAt(ownBoard, guess->row, guess->col);
+    ownBoard->boats[guess->row] &= ~bit;
+    ownBoard->hit[guess->row] |= bit;
+    guess->result = RESULT_HIT;
+    if (--ownBoard->lives[boat] > 0)
+    {
+        return FIELD_BOARD_NO_BOAT;
+    }
+    ownBoard->afloat &= ~(1u << boat);
+    return boat;
+}
+
+/** FieldBoardUpdateKnowledge(*oppBoard, *guess, sunkBoat)
+ *
+ * Records the result of one of the player's own shots.
+ *
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @param   *guess      The shot, with its result.
+ * @param   sunkBoat    What FieldBoardRegisterAttack() returned.
+ */
+void FieldBoardUpdateKnowledge(FieldBoard *oppBoard, const GuessData *guess, uint8_t sunkBoat)
+{
+    if (guess->row >= oppBoard->rules->rows || guess->col >= oppBoard->rules->cols)
+    {
+        return;
+    }
+    FieldBoardRow bit = (FieldBoardRow)1 << guess->col;
+    if (guess->result == RESULT_MISS)
+    {
+        oppBoard->miss[guess->row] |= bit;
+        oppBoard->hit[guess->row] &= ~bit;
+    }
+    else
+    {
+        oppBoard->hit[guess->row] |= bit;
+        oppBoard->miss[guess->row] &= ~bit;
+    }
+    if (sunkBoat < oppBoard->numBoats)
+    {
+        oppBoard->lives[sunkBoat] = 0;
+        oppBoard->afloat &= ~(1u << sunkBoat);
+    }
+}
+
+/** FieldBoardGetBoatStates(*b)
+ *
+ * @param   *b  The board.
+ * @return  One bit per boat, set while that boat is afloat.
+ */
+uint32_t FieldBoardGetBoatStates(const FieldBoard *b)
+{
+    return b->afloat;
+}
+
+/** FieldBoardDecideGuess(*oppBoard)
+ *
+ * The density hunter under any rules.
+ *
+ * @param   *oppBoard   The player's view of the opponent's board.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldBoardDecideGuess(const FieldBoard *oppBoard)
+{
+    const FieldRules *rules = oppBoard->rules;
+    uint64_t density[FIELD_BOARD_MAX_ROWS][FIELD_BOARD_MAX_COLS];
+    FieldBoardRow open[FIELD_BOARD_MAX_ROWS];       // Squares that are not misses
+    FieldBoardRow unknown[FIELD_BOARD_MAX_ROWS];
+    uint8_t afloat[FIELD_BOARD_MAX_TYPES] = {0};
+    FieldBoardRow cols = FieldBoardRun(rules->cols);
+
+    for (uint8_t b = 0; b < oppBoard->numBoats; b++)
+    {
+        afloat[oppBoard->boatType[b]] += (oppBoard->afloat >> b) & 1;
+    }
+    for (uint8_t row = 0; row < rules->rows; row++)
+    {
+        open[row] = ~oppBoard->miss[row] & cols;
+        unknown[row] = open[row] & ~oppBoard->hit[row];
+        for (uint8_t col = 0; col < rules->cols; col++)
+        {
+            density[row][col] = 0;
+        }
+    }
+
+    for (uint8_t t = 0; t < rules->numTypes; t++)
+    {
+        if (!afloat[t])
+        {
+            continue;
+        }
+        uint8_t size = rules->size[t];
+        FieldBoardRow run = FieldBoardRun(size);
+
+        for (uint8_t row = 0; row < rules->rows; row++)
+        {
+            // Horizontal placements: one run of bits in this row
+            FieldBoardRow starts = FieldBoardStartsEast(open[row], size, rules->cols);
+            while (starts)
+            {
+                uint8_t col = (uint8_t)__builtin_ctzll(starts);
+                starts &= starts - 1;
+                uint8_t hits = FieldBoardCount(oppBoard->hit[row] & (run << col));
+                uint64_t weight = afloat[t];
+                for (uint8_t h = 0; h < hits && h < FIELD_BOARD_MAX_WEIGHTED_HITS; h++)
+                {
+                    weight *= FIELD_DENSITY_HIT_WEIGHT;
+                }
+                FieldBoardRow cover = unknown[row] & (run << col);
+                while (cover)
+                {
+                    density[row][__builtin_ctzll(cover)] += weight;
+                    cover &= cover - 1;
+                }
+            }
+
+            // Vertical placements: the same column in `size` rows
+            if (row + size > rules->rows)
+            {
+                continue;
+            }
+            starts = FieldBoardStartsSouth(open, row, size);
+            while (starts)
+            {
+                uint8_t col = (uint8_t)__builtin_ctzll(starts);
+                FieldBoardRow bit = starts & -starts;
+                starts &= starts - 1;
+                uint8_t hits = 0;
+                for (uint8_t i = 0; i < size; i++)
+                {
+                    hits += (oppBoard->hit[row + i] & bit) != 0;
+                }
+                uint64_t weight = afloat[t];
+                for (uint8_t h = 0; h < hits && h < FIELD_BOARD_MAX_WEIGHTED_HITS; h++)
+                {
+                    weight *= FIELD_DENSITY_HIT_WEIGHT;
+                }
+                for (uint8_t i = 0; i < size; i++)
+                {
+                    if (unknown[row + i] & bit)
+                    {
+                        density[row + i][col] += weight;
+                    }
+                }
+            }
+        }
+    }
+
+    // The densest unknown square, first in scan order on ties
+    GuessData guess = {0, 0, RESULT_MISS};
+    uint8_t found = 0;
+    for (uint8_t row = 0; row < rules->rows; row++)
+    {
+        FieldBoardRow todo = unknown[row];
+        while (todo)
+        {
+            uint8_t col = (uint8_t)__builtin_ctzll(todo);
+            todo &= todo - 1;
+            if (!found || density[row][col] > density[guess.row][guess.col])
+            {
+                guess.row = row;
+                guess.col = col;
+                found = 1;
+            }
+        }
+    }
+    return guess;
+}
+
+/** FieldBoardShotsToWin(*rules, *rng)
+ *
+ * Counts the shots the density hunter needs against a random fleet.
+ *
+ * @param   *rules  Rules that pass FieldRulesCheck().
+ * @param   *rng    The generator for the fleet.
+ * @return  The number of shots.
+ */
+uint16_t FieldBoardShotsToWin(const FieldRules *rules, Rng *rng)
+{
+    uint16_t shots = 0;
+
+    if (FieldRulesIsStandard(rules))
+    {
+        Field target;
+        Field knowledge;
+        FieldInit(&target, &knowledge);
+        FieldAIPlaceAllBoatsRng(&target, rng);
+        while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+        {
+            GuessData guess = FieldDensityDecideGuess(&knowledge);
+            FieldRegisterEnemyAttack(&target, &guess);
+            FieldUpdateKnowledge(&knowledge, &guess);
+            shots++;
+        }
+        return shots;
+    }
+
+    FieldBoard target;
+    FieldBoard knowledge;
+    FieldBoardInit(&target, &knowledge, rules);
+    FieldBoardPlaceAllBoats(&target, rng);
+    while (FieldBoardGetBoatStates(&target) && shots < (uint16_t)rules->rows * rules->cols)
+    {
+        GuessData guess = FieldBoardDecideGuess(&knowledge);
+        uint8_t sunk = FieldBoardRegisterAttack(&target, &guess);
+        FieldBoardUpdateKnowledge(&knowledge, &guess, sunk);
+        shots++;
+    }
+    return shots;
+}
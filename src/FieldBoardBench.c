@@ -0,0 +1,132 @@
+/**
+ * @file    FieldBoardBench.c
+ *
+ * Measures games per second for the density hunter under several rule sets.
+ * The standard rules are run twice: through FieldBoardShotsToWin(), which
+ * takes the Field fast path, and through the generic FieldBoard code, to show
+ * what the fast path saves.
+ *
+ * A second table shows how the row-bitset board scales from 6x10 to 64x64
+ * with the standard fleet: guesses per second and the time for a whole game.
+ *
+ * @usage   `$ ./FieldBoard_bench [games] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldBoard.h"
+#include "Rng.h"
+
+#define DEFAULT_GAMES 2000
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * FieldBoardShotsToWin() without the fast path.
+ */
+static uint16_t GenericShotsToWin(const FieldRules *rules)
+{
+    static FieldBoard target;
+    static FieldBoard knowledge;
+    uint16_t shots = 0;
+
+    FieldBoardInit(&target, &knowledge, rules);
+    FieldBoardPlaceAllBoats(&target, RngDefault());
+    while (FieldBoardGetBoatStates(&target) && shots < (uint16_t)rules->rows * rules->cols)
+    {
+        GuessData guess = FieldBoardDecideGuess(&knowledge);
+        uint8_t sunk = FieldBoardRegisterAttack(&target, &guess);
+        FieldBoardUpdateKnowledge(&knowledge, &guess, sunk);
+        shots++;
+    }
+    return shots;
+}
+
+/**
+ * Plays `games` generic games and reports guesses per second and the average
+ * time and length of a game.
+ */
+static void Scale(const FieldRules *rules, uint32_t games)
+{
+    static FieldBoard target;
+    static FieldBoard knowledge;
+    uint64_t shots = 0;
+    uint64_t guessNanos = 0;
+    uint64_t start = NowNanos();
+
+    for (uint32_t g = 0; g < games; g++)
+    {
+        FieldBoardInit(&target, &knowledge, rules);
+        FieldBoardPlaceAllBoats(&target, RngDefault());
+        while (FieldBoardGetBoatStates(&target))
+        {
+            uint64_t before = NowNanos();
+            GuessData guess = FieldBoardDecideGuess(&knowledge);
+            guessNanos += NowNanos() - before;
+            uint8_t sunk = FieldBoardRegisterAttack(&target, &guess);
+            FieldBoardUpdateKnowledge(&knowledge, &guess, sunk);
+            shots++;
+        }
+    }
+    double gameMs = (NowNanos() - start) / 1e6 / games;
+    printf("%5ux%-5u %8u %14.0f %12.3f %12.1f\n", rules->rows, rules->cols, games,
+           shots * 1e9 / guessNanos, gameMs, (double)shots / games);
+}
+
+static void Report(const char *name, const FieldRules *rules, uint32_t games, uint8_t generic)
+{
+    uint64_t shots = 0;
+    uint64_t start = NowNanos();
+    for (uint32_t g = 0; g < games; g++)
+    {
+        shots += generic ? GenericShotsToWin(rules) : FieldBoardShotsToWin(rules, RngDefault());
+    }
+    double seconds = (NowNanos() - start) / 1e9;
+    printf("%-28s %5ux%-3u %12.0f %14.2f\n", name, rules->rows, rules->cols,
+           games / seconds, (double)shots / games);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t games = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_GAMES;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    const FieldRules classic = {10, 10, 4, {2, 3, 4, 5}, {1, 2, 1, 1}};
+    const FieldRules doubled = {12, 12, 4, {3, 4, 5, 6}, {2, 2, 2, 2}};
+    const FieldRules square = {8, 8, 3, {2, 3, 4}, {2, 1, 1}};
+
+    printf("=== FieldBoard benchmark: %u games per row, seed %u ===\n", games, seed);
+    printf("%-28s %9s %12s %14s\n", "rules", "board", "games/s", "shots to win");
+    Report("standard, Field fast path", &fieldRulesStandard, games, 0);
+    Report("standard, generic path", &fieldRulesStandard, games, 1);
+    Report("8x8, 2+2+3+4", &square, games, 0);
+    Report("10x10, 2+3+3+4+5", &classic, games, 0);
+    Report("12x12, two of 3/4/5/6", &doubled, games, 0);
+
+    // Fewer games on bigger boards, where each one takes far longer
+    const uint8_t sides[][2] = {{6, 10}, {16, 16}, {32, 32}, {64, 64}};
+    printf("\n%-11s %8s %14s %12s %12s\n", "board", "games", "guesses/s", "ms/game", "shots/game");
+    for (size_t i = 0; i < sizeof(sides) / sizeof(sides[0]); i++)
+    {
+        FieldRules scaled = fieldRulesStandard;
+        scaled.rows = sides[i][0];
+        scaled.cols = sides[i][1];
+        uint32_t squares = (uint32_t)scaled.rows * scaled.cols;
+        uint32_t scaledGames = games * FIELD_NUM_SQUARES / squares / (squares / FIELD_NUM_SQUARES);
+        Scale(&scaled, scaledGames ? scaledGames : 1);
+    }
+
+    return 0;
+}
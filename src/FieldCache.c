@@ -0,0 +1,175 @@
+/**
+ * @file    FieldCache.c
+ *
+ * Transposition cache for analysed opponent fields.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCache.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// Separates the keys of the analyses of one field
+#define FIELD_CACHE_KIND_KEY(kind) ((uint64_t)((kind) + 1) * 0x9E3779B97F4A7C15ull)
+
+
+/*  PROTOTYPES  */
+
+/** FieldCacheInit(*cache, *slots, count)
+ *
+ * @param   *cache      The cache.
+ * @param   *slots      Storage for count entries.
+ * @param   count       The number of entries, a power of two.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldCacheInit(FieldCache *cache, FieldCacheSlot *slots, uint32_t count)
+{
+    if (slots == NULL || count == 0 || (count & (count - 1)))
+    {
+        return STANDARD_ERROR;
+    }
+    cache->slots = slots;
+    cache->count = count;
+    FieldCacheClear(cache);
+    return SUCCESS;
+}
+
+/** FieldCacheClear(*cache)
+ *
+ * A slot with sequence number 0 has never been stored to.
+ *
+ * @param   *cache  The cache.
+ */
+void FieldCacheClear(FieldCache *cache)
+{
+    for (uint32_t i = 0; i < cache->count; i++)
+    {
+        FieldCacheSlot *slot = &cache->slots[i];
+        atomic_init(&slot->seq, 0);
+        atomic_init(&slot->key, 0);
+        for (uint8_t w = 0; w < FIELD_CACHE_ENTRY_WORDS; w++)
+        {
+            atomic_init(&slot->word[w], 0);
+        }
+    }
+}
+
+/** FieldCacheKey(*oppField, kind)
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   kind        The analysis.
+ * @return  The key.
+ */
+uint64_t FieldCacheKey(const Field *oppField, FieldCacheKind kind)
+{
+    return FieldGetHash(oppField) ^ FIELD_CACHE_KIND_KEY(kind);
+}
+
+/** FieldCacheLookup(*cache, key, *entry, *stats)
+ *
+ * The seqlock read: the sequence number is read before the copy and again
+ * after it, and the copy only counts if it was even and unchanged.
+ *
+ * @param   *cache  The cache.
+ * @param   key     From FieldCacheKey().
+ * @param   *entry  Receives the entry on a hit.
+ * @param   *stats  Counters to update, or NULL.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldCacheLookup(const FieldCache *cache, uint64_t key, FieldCacheEntry *entry,
+                         FieldCacheStats *stats)
+{
+    FieldCacheSlot *slot = &cache->slots[key & (cache->count - 1)];
+    uint64_t words[FIELD_CACHE_ENTRY_WORDS];
+
+    if (stats != NULL)
+    {
+        stats->lookups++;
+    }
+    uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+    if (seq == 0 || (seq & 1))
+    {
+        return STANDARD_ERROR;
+    }
+    uint64_t slotKey = atomic_load_explicit(&slot->key, memory_order_relaxed);
+    for (uint8_t w = 0; w < FIELD_CACHE_ENTRY_WORDS; w++)
+    {
+        words[w] = atomic_load_explicit(&slot->word[w], memory_order_relaxed);
+    }
+    // Orders the copy before the second read of seq
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq || slotKey != key)
+    {
+        return STANDARD_ERROR;
+    }
+    if (stats != NULL)
+    {
+        stats->hits++;
+    }
+    memcpy(entry, words, sizeof(*entry));
+    return SUCCESS;
+}
+
+/** FieldCacheStore(*cache, key, *entry, *stats)
+ *
+ * The seqlock write. Claiming the slot by making its sequence number odd
+ * keeps two stores from writing it at once.
+ *
+ * @param   *cache  The cache.
+ * @param   key     From FieldCacheKey().
+ * @param   *entry  The best guess and probabilities.
+ * @param   *stats  Counters to update, or NULL.
+ */
+void FieldCacheStore(FieldCache *cache, uint64_t key, const FieldCacheEntry *entry,
+                     FieldCacheStats *stats)
+{
+    FieldCacheSlot *slot = &cache->slots[key & (cache->count - 1)];
+    uint64_t words[FIELD_CACHE_ENTRY_WORDS] = {0};
+    memcpy(words, entry, sizeof(*entry));
+
+    if (stats != NULL)
+    {
+        stats->stores++;
+    }
+    uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_relaxed);
+    if ((seq & 1) ||
+        !atomic_compare_exchange_strong_explicit(&slot->seq, &seq, seq + 1,
+                                                 memory_order_relaxed, memory_order_relaxed))
+    {
+        return;
+    }
+    // Orders the odd sequence number before the writes below
+    atomic_thread_fence(memory_order_release);
+
+    if (stats != NULL && seq != 0 &&
+        atomic_load_explicit(&slot->key, memory_order_relaxed) != key)
+    {
+        stats->evictions++;
+    }
+    atomic_store_explicit(&slot->key, key, memory_order_relaxed);
+    for (uint8_t w = 0; w < FIELD_CACHE_ENTRY_WORDS; w++)
+    {
+        atomic_store_explicit(&slot->word[w], words[w], memory_order_relaxed);
+    }
+    atomic_store_explicit(&slot->seq, seq + 2, memory_order_release);
+}
+
+/** FieldCacheGuess(*entry)
+ *
+ * @param   *entry  A cache entry.
+ * @return  The entry's best guess.
+ */
+GuessData FieldCacheGuess(const FieldCacheEntry *entry)
+{
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(entry->square);
+    guess.col = FIELD_BITBOARD_COL(entry->square);
+    guess.result = RESULT_MISS;
+    return guess;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file    FieldCount.c
+ *
+ * Exact fleet count and uniform fleet sampling by index.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCount.h"
+#include "FieldPlacement.h"
+#include "Rng.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_COUNT_LARGE_PLACEMENTS FIELD_PLACEMENTS_OF_SIZE(FIELD_BOAT_SIZE_LARGE)
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldCountFree(type, occupied)
+ *
+ * The number of placements of `type` that avoid `occupied`.
+ */
+static uint32_t FieldCountFree(BoatType type, FieldBitboard occupied)
+{
+    uint32_t n = 0;
+    for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+    {
+        n += !FieldBitboardAnd(fieldPlacements[p].mask, occupied);
+    }
+    return n;
+}
+
+/** FieldCountRest(occupied)
+ *
+ * The number of ways to place the medium and small boats around `occupied`.
+ */
+static uint32_t FieldCountRest(FieldBitboard occupied)
+{
+    uint32_t n = 0;
+    for (uint16_t p = fieldPlacementFirst[FIELD_BOAT_TYPE_MEDIUM];
+         p < fieldPlacementFirst[FIELD_BOAT_TYPE_MEDIUM + 1]; p++)
+    {
+        FieldBitboard mask = fieldPlacements[p].mask;
+        if (!FieldBitboardAnd(mask, occupied))
+        {
+            n += FieldCountFree(FIELD_BOAT_TYPE_SMALL, occupied | mask);
+        }
+    }
+    return n;
+}
+
+/** FieldCountPlace(*ownField, p)
+ *
+ * Adds placement p to ownField.
+ */
+static uint8_t FieldCountPlace(Field *ownField, uint16_t p)
+{
+    const FieldPlacement *place = &fieldPlacements[p];
+    return FieldAddBoat(ownField, place->row, place->col, place->dir, place->type);
+}
+
+/*  PROTOTYPES  */
+
+/** FieldCountInit(*count)
+ *
+ * Counts every fleet on an empty field.
+ *
+ * @param   *count  The table to fill.
+ * @return  The number of fleets.
+ */
+uint32_t FieldCountInit(FieldCount *count)
+{
+    uint32_t total = 0;
+    uint32_t k = 0;
+
+    for (uint16_t h = fieldPlacementFirst[FIELD_BOAT_TYPE_HUGE];
+         h < fieldPlacementFirst[FIELD_BOAT_TYPE_HUGE + 1]; h++)
+    {
+        FieldBitboard huge = fieldPlacements[h].mask;
+        for (uint16_t l = fieldPlacementFirst[FIELD_BOAT_TYPE_LARGE];
+             l < fieldPlacementFirst[FIELD_BOAT_TYPE_LARGE + 1]; l++)
+        {
+            FieldBitboard large = fieldPlacements[l].mask;
+            count->below[k++] = total;
+            if (!FieldBitboardAnd(huge, large))
+            {
+                total += FieldCountRest(huge | large);
+            }
+        }
+    }
+    count->below[FIELD_COUNT_PAIRS] = total;
+    return total;
+}
+
+/** FieldCountTotal(*count)
+ *
+ * @param   *count  A table filled by FieldCountInit().
+ * @return  The number of fleets.
+ */
+uint32_t FieldCountTotal(const FieldCount *count)
+{
+    return count->below[FIELD_COUNT_PAIRS];
+}
+
+/** FieldCountUnrank(*count, index, *ownField)
+ *
+ * Places the fleet numbered `index` on ownField.
+ *
+ * @param   *count      A table filled by FieldCountInit().
+ * @param   index       The fleet to place.
+ * @param   *ownField   A field with no boats yet.
+ * @return  SUCCESS, or STANDARD_ERROR if index is out of range or a boat did
+ *          not fit.
+ */
+uint8_t FieldCountUnrank(const FieldCount *count, uint32_t index, Field *ownField)
+{
+    if (index >= FieldCountTotal(count))
+    {
+        return STANDARD_ERROR;
+    }
+
+    // The last pair whose running sum is at most index. Pairs that overlap
+    // add nothing, so the last one is the pair that holds index.
+    uint32_t lo = 0;
+    uint32_t hi = FIELD_COUNT_PAIRS;
+    while (hi - lo > 1)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (count->below[mid] <= index)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    uint32_t rest = index - count->below[lo];
+    uint16_t h = fieldPlacementFirst[FIELD_BOAT_TYPE_HUGE] + lo / FIELD_COUNT_LARGE_PLACEMENTS;
+    uint16_t l = fieldPlacementFirst[FIELD_BOAT_TYPE_LARGE] + lo % FIELD_COUNT_LARGE_PLACEMENTS;
+    FieldBitboard occupied = fieldPlacements[h].mask | fieldPlacements[l].mask;
+
+    for (uint16_t m = fieldPlacementFirst[FIELD_BOAT_TYPE_MEDIUM];
+         m < fieldPlacementFirst[FIELD_BOAT_TYPE_MEDIUM + 1]; m++)
+    {
+        FieldBitboard mask = fieldPlacements[m].mask;
+        if (FieldBitboardAnd(mask, occupied))
+        {
+            continue;
+        }
+        uint32_t ways = FieldCountFree(FIELD_BOAT_TYPE_SMALL, occupied | mask);
+        if (rest >= ways)
+        {
+            rest -= ways;
+            continue;
+        }
+
+        for (uint16_t s = fieldPlacementFirst[FIELD_BOAT_TYPE_SMALL];
+             s < fieldPlacementFirst[FIELD_BOAT_TYPE_SMALL + 1]; s++)
+        {
+            if (FieldBitboardAnd(fieldPlacements[s].mask, occupied | mask))
+            {
+                continue;
+            }
+            if (rest-- == 0)
+            {
+                if (FieldCountPlace(ownField, h) && FieldCountPlace(ownField, l) &&
+                    FieldCountPlace(ownField, m) && FieldCountPlace(ownField, s))
+                {
+                    return SUCCESS;
+                }
+                return STANDARD_ERROR;
+            }
+        }
+    }
+    return STANDARD_ERROR;
+}
+
+/** FieldCountSample(*count, *ownField, *rng)
+ *
+ * Places a fleet drawn uniformly from every fleet.
+ *
+ * @param   *count      A table filled by FieldCountInit().
+ * @param   *ownField   A field with no boats yet.
+ * @param   *rng        The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldCountSample(const FieldCount *count, Field *ownField, Rng *rng)
+{
+    uint32_t total = FieldCountTotal(count);
+    if (total == 0)
+    {
+        return STANDARD_ERROR;
+    }
+    return FieldCountUnrank(count, RngBelow(rng, total), ownField);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file    FieldCountBench.c
+ *
+ * Times the exact fleet count and fleet unranking, and compares sampling by
+ * index with FieldAIPlaceAllBoatsUniform(). Then repeats the count on other
+ * board sizes to show how it scales. Those boards are counted with masks built
+ * here, because the placement tables only cover FIELD_ROWS x FIELD_COLS.
+ *
+ * @usage   `$ ./FieldCount_bench [fleets] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCount.h"
+#include "Rng.h"
+
+#define DEFAULT_FLEETS 200000
+
+// The largest board whose squares fit in one FieldBitboard
+#define MAX_SQUARES 64
+#define MAX_MASKS (2 * MAX_SQUARES)
+
+static FieldCount count;
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * Fills `masks` with every placement of a boat of length `size` on a
+ * rows x cols board and returns how many there are.
+ */
+static uint16_t BoardMasks(uint8_t rows, uint8_t cols, uint8_t size, uint64_t masks[MAX_MASKS])
+{
+    uint16_t n = 0;
+    for (uint8_t row = 0; row < rows; row++)
+    {
+        for (uint8_t col = 0; col < cols; col++)
+        {
+            uint64_t east = 0;
+            uint64_t south = 0;
+            for (uint8_t i = 0; i < size; i++)
+            {
+                east |= (col + size <= cols) ? 1ull << (row * cols + col + i) : 0;
+                south |= (row + size <= rows) ? 1ull << ((row + i) * cols + col) : 0;
+            }
+            if (east)
+            {
+                masks[n++] = east;
+            }
+            if (south)
+            {
+                masks[n++] = south;
+            }
+        }
+    }
+    return n;
+}
+
+/**
+ * Counts every fleet on a rows x cols board with the same split as
+ * FieldCountInit(): (huge, large) pairs, then medium, then the small boats
+ * counted directly.
+ */
+static uint64_t BoardCount(uint8_t rows, uint8_t cols, uint16_t placements[FIELD_NUM_BOATS])
+{
+    static uint64_t masks[FIELD_NUM_BOATS][MAX_MASKS];
+    const uint8_t sizes[FIELD_NUM_BOATS] = {
+        FIELD_BOAT_SIZE_SMALL, FIELD_BOAT_SIZE_MEDIUM, FIELD_BOAT_SIZE_LARGE, FIELD_BOAT_SIZE_HUGE};
+    uint16_t *n = placements;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        n[type] = BoardMasks(rows, cols, sizes[type], masks[type]);
+    }
+
+    uint64_t total = 0;
+    for (uint16_t h = 0; h < n[FIELD_BOAT_TYPE_HUGE]; h++)
+    {
+        uint64_t huge = masks[FIELD_BOAT_TYPE_HUGE][h];
+        for (uint16_t l = 0; l < n[FIELD_BOAT_TYPE_LARGE]; l++)
+        {
+            uint64_t pair = masks[FIELD_BOAT_TYPE_LARGE][l];
+            if (pair & huge)
+            {
+                continue;
+            }
+            pair |= huge;
+            for (uint16_t m = 0; m < n[FIELD_BOAT_TYPE_MEDIUM]; m++)
+            {
+                uint64_t occupied = masks[FIELD_BOAT_TYPE_MEDIUM][m];
+                if (occupied & pair)
+                {
+                    continue;
+                }
+                occupied |= pair;
+                for (uint16_t s = 0; s < n[FIELD_BOAT_TYPE_SMALL]; s++)
+                {
+                    total += !(masks[FIELD_BOAT_TYPE_SMALL][s] & occupied);
+                }
+            }
+        }
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t fleets = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_FLEETS;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    printf("=== FieldCount benchmark: %u fleets, seed %u ===\n", fleets, seed);
+
+    uint64_t start = NowNanos();
+    uint32_t total = FieldCountInit(&count);
+    uint64_t initNanos = NowNanos() - start;
+    printf("%ux%u fleets: %u, table built in %.2f ms (%u bytes)\n",
+           FIELD_ROWS, FIELD_COLS, total, initNanos / 1e6, (unsigned)sizeof(count));
+
+    // Sampling by index against restarting until the fleet fits
+    uint64_t unrankNanos = 0;
+    uint64_t uniformNanos = 0;
+    for (uint32_t f = 0; f < fleets; f++)
+    {
+        Field field;
+        FieldInit(&field, NULL);
+        start = NowNanos();
+        FieldCountSample(&count, &field, RngDefault());
+        unrankNanos += NowNanos() - start;
+
+        FieldInit(&field, NULL);
+        start = NowNanos();
+        FieldAIPlaceAllBoatsUniform(&field);
+        uniformNanos += NowNanos() - start;
+    }
+    printf("%-30s %12.0f fleets/s %8.1f ns/fleet\n", "FieldCountSample",
+           fleets * 1e9 / unrankNanos, (double)unrankNanos / fleets);
+    printf("%-30s %12.0f fleets/s %8.1f ns/fleet\n", "FieldAIPlaceAllBoatsUniform",
+           fleets * 1e9 / uniformNanos, (double)uniformNanos / fleets);
+
+    // Scaling with board size
+    const uint8_t boards[][2] = {{6, 6}, {6, 8}, {6, 10}, {7, 9}, {8, 8}};
+    printf("\n%-8s %24s %16s %10s\n", "board", "placements (S/M/L/H)", "fleets", "ms");
+    for (size_t b = 0; b < sizeof(boards) / sizeof(boards[0]); b++)
+    {
+        uint16_t placements[FIELD_NUM_BOATS];
+        start = NowNanos();
+        uint64_t fleetsOnBoard = BoardCount(boards[b][0], boards[b][1], placements);
+        double ms = (NowNanos() - start) / 1e6;
+        char name[8];
+        char sizes[32];
+        snprintf(name, sizeof(name), "%ux%u", boards[b][0], boards[b][1]);
+        snprintf(sizes, sizeof(sizes), "%u/%u/%u/%u", placements[0], placements[1],
+                 placements[2], placements[3]);
+        printf("%-8s %24s %16llu %10.2f\n", name, sizes, (unsigned long long)fleetsOnBoard, ms);
+    }
+    printf("Boards above %u squares need more than one FieldBitboard.\n", MAX_SQUARES);
+
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file    FieldDensity.c
+ *
+ * Probability-density targeting for the opponent's field.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldPlacement.h"
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldDensityWeight(mask, hits)
+ *
+ * The weight of one placement: FIELD_DENSITY_HIT_WEIGHT per covered hit.
+ */
+static uint32_t FieldDensityWeight(FieldBitboard mask, FieldBitboard hits)
+{
+    uint32_t weight = 1;
+    for (uint8_t h = FieldBitboardCount(FieldBitboardAnd(mask, hits)); h > 0; h--)
+    {
+        weight *= FIELD_DENSITY_HIT_WEIGHT;
+    }
+    return weight;
+}
+
+/** FieldDensityAddPlacement(density, mask, hits, unknown)
+ *
+ * Adds one placement to the density map, weighted by how many known hits it
+ * covers. Only unknown squares are tallied.
+ */
+static void FieldDensityAddPlacement(uint32_t density[FIELD_NUM_SQUARES],
+                                     FieldBitboard mask, FieldBitboard hits,
+                                     FieldBitboard unknown)
+{
+    uint32_t weight = FieldDensityWeight(mask, hits);
+    FieldBitboard todo = FieldBitboardAnd(mask, unknown);
+    while (todo)
+    {
+        density[FieldBitboardPopFirst(&todo)] += weight;
+    }
+}
+
+/** FieldDensityMapAdd(*map, mask, delta)
+ *
+ * Adds delta to every square of mask. Subtraction is done by passing the two's
+ * complement; the unsigned arithmetic wraps back to the exact count.
+ */
+static void FieldDensityMapAdd(FieldDensityMap *map, FieldBitboard mask, uint32_t delta)
+{
+    while (mask)
+    {
+        map->density[FieldBitboardPopFirst(&mask)] += delta;
+    }
+}
+
+/** FieldDensityMapShot(*map, square, isHit)
+ *
+ * Adjusts every live placement through one newly shot square. A miss removes
+ * the placement; a hit multiplies its weight by FIELD_DENSITY_HIT_WEIGHT.
+ * Only placements that can reach the square are looked up, at most 2 * size
+ * per boat, instead of walking the whole placement table.
+ */
+static void FieldDensityMapShot(FieldDensityMap *map, uint8_t square, uint8_t isHit)
+{
+    uint8_t row = FIELD_BITBOARD_ROW(square);
+    uint8_t col = FIELD_BITBOARD_COL(square);
+    FieldBitboard bit = FIELD_BITBOARD_SQUARE(row, col);
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(map->alive & (1 << type)))
+        {
+            continue;
+        }
+        for (uint8_t back = 0; back < fieldBoatSizes[type]; back++)
+        {
+            FieldBitboard masks[2] = {0, 0};
+            if (row >= back)
+            {
+                masks[FIELD_DIR_SOUTH] = fieldPlacementMasks[type][row - back][col][FIELD_DIR_SOUTH];
+            }
+            if (col >= back)
+            {
+                masks[FIELD_DIR_EAST] = fieldPlacementMasks[type][row][col - back][FIELD_DIR_EAST];
+            }
+
+            for (uint8_t dir = 0; dir < 2; dir++)
+            {
+                FieldBitboard mask = masks[dir];
+                if (!mask || FieldBitboardAnd(mask, map->misses))
+                {
+                    continue;
+                }
+                uint32_t weight = FieldDensityWeight(mask, map->hits);
+                FieldDensityMapAdd(map, mask, isHit ? weight * (FIELD_DENSITY_HIT_WEIGHT - 1) : -weight);
+            }
+        }
+    }
+
+    if (isHit)
+    {
+        map->hits |= bit;
+    }
+    else
+    {
+        map->misses |= bit;
+    }
+}
+
+/*  PROTOTYPES  */
+
+/** FieldDensityCompute(*oppField, density)
+ *
+ * Fills density[] with the weighted number of legal placements of each alive
+ * boat that cover each square. A placement is legal if it lies within the
+ * field and covers no FIELD_SQUARE_MISS.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   density     Output, indexed by FIELD_BITBOARD_INDEX(row, col).
+ */
+void FieldDensityCompute(const Field *oppField, uint32_t density[FIELD_NUM_SQUARES])
+{
+    FieldBitboard misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    FieldBitboard hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    uint8_t alive = FieldGetBoatStates(oppField);
+
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        density[i] = 0;
+    }
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        // FIELD_BOAT_STATUS_* flags are one bit per BoatType
+        if (!(alive & (1 << type)))
+        {
+            continue;
+        }
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (!FieldBitboardAnd(mask, misses))
+            {
+                FieldDensityAddPlacement(density, mask, hits, unknown);
+            }
+        }
+    }
+}
+
+/** FieldDensityDecideGuess(*oppField)
+ *
+ * Fires at the unknown square with the highest density, breaking ties by scan
+ * order.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldDensityDecideGuess(const Field *oppField)
+{
+    uint32_t density[FIELD_NUM_SQUARES];
+    FieldDensityCompute(oppField, density);
+
+    uint8_t best = FieldBitboardFirst(FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN));
+    if (best == FIELD_NUM_SQUARES)
+    {
+        // Nothing left to shoot at; any in-bounds square will do
+        best = 0;
+    }
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        if (density[i] > density[best])
+        {
+            best = i;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
+
+/** FieldDensityMapInit(*map, *oppField)
+ *
+ * Builds a map from scratch for oppField.
+ *
+ * @param   *map        The map to fill.
+ * @param   *oppField   The opponent's field.
+ */
+void FieldDensityMapInit(FieldDensityMap *map, const Field *oppField)
+{
+    map->misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    map->hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    map->alive = FieldGetBoatStates(oppField);
+
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        map->density[i] = 0;
+    }
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(map->alive & (1 << type)))
+        {
+            continue;
+        }
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (!FieldBitboardAnd(mask, map->misses))
+            {
+                FieldDensityMapAdd(map, mask, FieldDensityWeight(mask, map->hits));
+            }
+        }
+    }
+}
+
+/** FieldDensityMapUpdate(*map, *oppField)
+ *
+ * Brings a map up to date with oppField.
+ *
+ * @param   *map        A map built by FieldDensityMapInit().
+ * @param   *oppField   The opponent's field.
+ * @return  1 if the map was updated incrementally, 0 if it was rebuilt.
+ */
+uint8_t FieldDensityMapUpdate(FieldDensityMap *map, const Field *oppField)
+{
+    FieldBitboard misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    FieldBitboard hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    uint8_t alive = FieldGetBoatStates(oppField);
+
+    // Knowledge only ever grows during a game; anything else is a new field
+    if (FieldBitboardAndNot(map->misses, misses) || FieldBitboardAndNot(map->hits, hits) ||
+        (alive & ~map->alive))
+    {
+        FieldDensityMapInit(map, oppField);
+        return 0;
+    }
+
+    // Sunk boats first, weighted by the hits their placements were counted with
+    uint8_t sunk = map->alive & ~alive;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(sunk & (1 << type)))
+        {
+            continue;
+        }
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (!FieldBitboardAnd(mask, map->misses))
+            {
+                FieldDensityMapAdd(map, mask, -FieldDensityWeight(mask, map->hits));
+            }
+        }
+    }
+    map->alive = alive;
+
+    FieldBitboard todo = FieldBitboardAndNot(misses, map->misses);
+    while (todo)
+    {
+        FieldDensityMapShot(map, FieldBitboardPopFirst(&todo), 0);
+    }
+    todo = FieldBitboardAndNot(hits, map->hits);
+    while (todo)
+    {
+        FieldDensityMapShot(map, FieldBitboardPopFirst(&todo), 1);
+    }
+    return 1;
+}
+
+/** FieldDensityMapBestGuess(*map, *oppField)
+ *
+ * Fires at the unknown square with the highest density, breaking ties by scan
+ * order.
+ *
+ * @param   *map        A map that is up to date with oppField.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldDensityMapBestGuess(const FieldDensityMap *map, const Field *oppField)
+{
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    uint8_t best = FieldBitboardFirst(unknown);
+    if (best == FIELD_NUM_SQUARES)
+    {
+        // Nothing left to shoot at; any in-bounds square will do
+        best = 0;
+    }
+    while (unknown)
+    {
+        uint8_t i = FieldBitboardPopFirst(&unknown);
+        if (map->density[i] > map->density[best])
+        {
+            best = i;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file    FieldDensityBench.c
+ *
+ * Plays the density AI against the stock FieldAIDecideGuess() heuristic and
+ * reports win rate, average shots-to-win and time per decision. Also times
+ * rebuilding the density map every turn against keeping a FieldDensityMap up
+ * to date over the same games.
+ *
+ * @usage   `$ ./FieldDensity_bench [games] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "Rng.h"
+
+#define DEFAULT_GAMES 2000
+
+typedef GuessData (*GuessFunction)(const Field *oppField);
+
+typedef struct {
+    const char *name;
+    GuessFunction decide;
+    uint64_t shots;     // Total shots over all solo games
+    uint64_t nanos;     // Total time spent deciding
+    uint32_t wins;      // Head-to-head wins
+} Player;
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * Fires one timed shot from `player` at `target`, updating its knowledge.
+ */
+static void TakeShot(Player *player, Field *target, Field *knowledge)
+{
+    uint64_t start = NowNanos();
+    GuessData guess = player->decide(knowledge);
+    player->nanos += NowNanos() - start;
+
+    FieldRegisterEnemyAttack(target, &guess);
+    FieldUpdateKnowledge(knowledge, &guess);
+}
+
+/**
+ * Plays `player` alone against a copy of `layout` and returns the number of
+ * shots it needed to sink every boat.
+ */
+static uint16_t ShotsToWin(Player *player, const Field *layout)
+{
+    Field target = *layout;
+    Field knowledge;
+    FieldInit(NULL, &knowledge);
+
+    uint16_t shots = 0;
+    while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+    {
+        TakeShot(player, &target, &knowledge);
+        shots++;
+    }
+    return shots;
+}
+
+/**
+ * Plays one alternating game between a and b. Returns the winner.
+ */
+static Player *HeadToHead(Player *a, Player *b)
+{
+    Field fieldA, fieldB, knowledgeA, knowledgeB;
+    FieldInit(&fieldA, &knowledgeA);
+    FieldInit(&fieldB, &knowledgeB);
+    FieldAIPlaceAllBoats(&fieldA);
+    FieldAIPlaceAllBoats(&fieldB);
+
+    Player *turn = RngBelow(RngDefault(), 2) ? a : b;
+    while (1)
+    {
+        if (turn == a)
+        {
+            TakeShot(a, &fieldB, &knowledgeA);
+            if (!FieldGetBoatStates(&fieldB))
+            {
+                return a;
+            }
+            turn = b;
+        }
+        else
+        {
+            TakeShot(b, &fieldA, &knowledgeB);
+            if (!FieldGetBoatStates(&fieldA))
+            {
+                return b;
+            }
+            turn = a;
+        }
+    }
+}
+
+/**
+ * Plays one density game on `layout`, timing a full FieldDensityCompute() and
+ * an incremental FieldDensityMapUpdate() for every turn. Counts the turns on
+ * which the two maps disagree on an unknown square.
+ */
+static void CompareIncremental(const Field *layout, uint64_t *fullNanos, uint64_t *incNanos,
+                               uint32_t *turns, uint32_t *mismatches)
+{
+    Field target = *layout;
+    Field knowledge;
+    FieldDensityMap map;
+    uint32_t density[FIELD_NUM_SQUARES];
+    FieldInit(NULL, &knowledge);
+    FieldDensityMapInit(&map, &knowledge);
+
+    while (FieldGetBoatStates(&target) && *turns < UINT32_MAX)
+    {
+        uint64_t start = NowNanos();
+        FieldDensityCompute(&knowledge, density);
+        uint64_t middle = NowNanos();
+        FieldDensityMapUpdate(&map, &knowledge);
+        uint64_t end = NowNanos();
+        *fullNanos += middle - start;
+        *incNanos += end - middle;
+        (*turns)++;
+
+        FieldBitboard unknown = FieldGetBitboard(&knowledge, FIELD_SQUARE_UNKNOWN);
+        while (unknown)
+        {
+            uint8_t i = FieldBitboardPopFirst(&unknown);
+            if (density[i] != map.density[i])
+            {
+                (*mismatches)++;
+                break;
+            }
+        }
+
+        GuessData guess = FieldDensityMapBestGuess(&map, &knowledge);
+        FieldRegisterEnemyAttack(&target, &guess);
+        FieldUpdateKnowledge(&knowledge, &guess);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t games = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_GAMES;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    Player heuristic = {.name = "heuristic", .decide = FieldAIDecideGuess};
+    Player density = {.name = "density", .decide = FieldDensityDecideGuess};
+
+    uint64_t fullNanos = 0, incNanos = 0;
+    uint32_t turns = 0, mismatches = 0;
+
+    // Solo runs: both players shoot at the same layouts
+    for (uint32_t g = 0; g < games; g++)
+    {
+        Field layout;
+        FieldInit(&layout, NULL);
+        FieldAIPlaceAllBoats(&layout);
+        heuristic.shots += ShotsToWin(&heuristic, &layout);
+        density.shots += ShotsToWin(&density, &layout);
+        CompareIncremental(&layout, &fullNanos, &incNanos, &turns, &mismatches);
+    }
+    uint64_t heuristicNanos = heuristic.nanos;
+    uint64_t densityNanos = density.nanos;
+
+    for (uint32_t g = 0; g < games; g++)
+    {
+        HeadToHead(&density, &heuristic)->wins++;
+    }
+
+    printf("=== FieldDensity benchmark: %u games, seed %u ===\n", games, seed);
+    printf("%-10s %12s %14s %10s\n", "player", "avg shots", "us/decision", "win rate");
+    Player *players[] = {&heuristic, &density};
+    uint64_t soloNanos[] = {heuristicNanos, densityNanos};
+    for (int i = 0; i < 2; i++)
+    {
+        printf("%-10s %12.2f %14.3f %9.1f%%\n",
+               players[i]->name,
+               (double)players[i]->shots / games,
+               soloNanos[i] / 1000.0 / players[i]->shots,
+               100.0 * players[i]->wins / games);
+    }
+
+    printf("\ndensity map per turn: full %.3f us, incremental %.3f us (%.1fx), "
+           "%u mismatches in %u turns\n",
+           fullNanos / 1000.0 / turns, incNanos / 1000.0 / turns,
+           incNanos ? (double)fullNanos / incNanos : 0.0, mismatches, turns);
+
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * @file    FieldEntropy.c
+ *
+ * Information-gain targeting for the opponent's field.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldEntropy.h"
+#include "FieldExact.h"
+#include "FieldPlacement.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// Samples between clock reads, as in FieldSamplerRun()
+#define FIELD_ENTROPY_CLOCK_STRIDE 64
+
+// Samples the bit-sliced counters can hold before they are folded
+#define FIELD_ENTROPY_TALLY_MAX ((1u << FIELD_ENTROPY_TALLY_BITS) - 1)
+
+/**
+ * FIELD_NUM_SQUARES counters side by side: bit i of plane[k] is bit k of
+ * square i's count.
+ */
+typedef struct {
+    FieldBitboard plane[FIELD_ENTROPY_TALLY_BITS];
+} FieldEntropyTally;
+
+
+/*  TABLES  */
+
+/**
+ * -p log2 p for p = k / 256, in bits with 12 fractional bits.
+ */
+static const uint16_t fieldEntropyTable[257] = {
+       0,  128,  224,  308,  384,  454,  520,  582,  640,  696,  748,  799,
+     848,  894,  939,  982, 1024, 1064, 1103, 1141, 1177, 1212, 1246, 1279,
+    1311, 1342, 1373, 1402, 1430, 1458, 1485, 1511, 1536, 1561, 1584, 1608,
+    1630, 1652, 1673, 1694, 1714, 1733, 1752, 1771, 1789, 1806, 1823, 1839,
+    1855, 1870, 1885, 1899, 1913, 1927, 1940, 1952, 1965, 1976, 1988, 1999,
+    2009, 2020, 2029, 2039, 2048, 2057, 2065, 2073, 2081, 2088, 2095, 2102,
+    2108, 2114, 2120, 2125, 2131, 2135, 2140, 2144, 2148, 2152, 2155, 2158,
+    2161, 2163, 2165, 2167, 2169, 2171, 2172, 2173, 2173, 2174, 2174, 2174,
+    2173, 2173, 2172, 2171, 2170, 2168, 2167, 2165, 2162, 2160, 2157, 2155,
+    2152, 2148, 2145, 2141, 2137, 2133, 2129, 2124, 2120, 2115, 2110, 2104,
+    2099, 2093, 2087, 2081, 2075, 2068, 2062, 2055, 2048, 2041, 2033, 2026,
+    2018, 2010, 2002, 1994, 1986, 1977, 1968, 1959, 1950, 1941, 1932, 1922,
+    1912, 1903, 1893, 1882, 1872, 1862, 1851, 1840, 1829, 1818, 1807, 1795,
+    1784, 1772, 1760, 1748, 1736, 1724, 1711, 1699, 1686, 1673, 1660, 1647,
+    1633, 1620, 1606, 1593, 1579, 1565, 1551, 1537, 1522, 1508, 1493, 1478,
+    1463, 1448, 1433, 1418, 1403, 1387, 1371, 1356, 1340, 1324, 1308, 1291,
+    1275, 1258, 1242, 1225, 1208, 1191, 1174, 1157, 1140, 1122, 1105, 1087,
+    1069, 1051, 1033, 1015,  997,  979,  960,  942,  923,  904,  885,  866,
+     847,  828,  809,  789,  770,  750,  730,  710,  690,  670,  650,  630,
+     610,  589,  569,  548,  527,  506,  485,  464,  443,  422,  401,  379,
+     358,  336,  314,  292,  270,  248,  226,  204,  182,  159,  137,  114,
+      92,   69,   46,   23,    0,
+};
+
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldEntropyTallyAdd(*tally, mask)
+ *
+ * Adds one to the counter of every square in mask: a ripple-carry add across
+ * the planes, all squares at once.
+ */
+static inline void FieldEntropyTallyAdd(FieldEntropyTally *tally, FieldBitboard mask)
+{
+    for (uint8_t k = 0; mask && k < FIELD_ENTROPY_TALLY_BITS; k++)
+    {
+        FieldBitboard carry = tally->plane[k] & mask;
+        tally->plane[k] ^= mask;
+        mask = carry;
+    }
+}
+
+/** FieldEntropyTallyFold(*tally, count)
+ *
+ * Adds the bit-sliced counters to count[] and clears them.
+ */
+static void FieldEntropyTallyFold(FieldEntropyTally *tally, uint32_t count[FIELD_NUM_SQUARES])
+{
+    for (uint8_t k = 0; k < FIELD_ENTROPY_TALLY_BITS; k++)
+    {
+        FieldBitboard todo = tally->plane[k];
+        while (todo)
+        {
+            count[FieldBitboardPopFirst(&todo)] += 1u << k;
+        }
+        tally->plane[k] = 0;
+    }
+}
+
+/** FieldEntropyClear(*entropy)
+ */
+static void FieldEntropyClear(FieldEntropy *entropy)
+{
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        entropy->cover[i] = 0;
+        for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+        {
+            entropy->sink[type][i] = 0;
+        }
+    }
+    entropy->total = 0;
+}
+
+/** FieldEntropyTerm(count, total)
+ *
+ * -p log2 p for p = count / total, from the table.
+ */
+static uint32_t FieldEntropyTerm(uint32_t count, uint32_t total)
+{
+    return fieldEntropyTable[((uint64_t)count * 256 + total / 2) / total];
+}
+
+/** FieldEntropyIsSingle(b)
+ *
+ * Nonzero if exactly one bit of b is set.
+ */
+static inline uint8_t FieldEntropyIsSingle(FieldBitboard b)
+{
+    return b && !(b & (b - 1));
+}
+
+/*  PROTOTYPES  */
+
+/** FieldEntropyExact(*entropy, *oppField, budgetMicros)
+ *
+ * A placement with one unknown square left sinks its boat when that square
+ * is shot; any other placement is hit wherever it is still unknown.
+ *
+ * @param   *entropy        Receives the counts.
+ * @param   *oppField       The opponent's field.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @return  The number of configurations, or 0.
+ */
+uint32_t FieldEntropyExact(FieldEntropy *entropy, const Field *oppField, uint32_t budgetMicros)
+{
+    uint64_t count[FIELD_NUM_PLACEMENTS];
+    uint8_t complete;
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+
+    FieldEntropyClear(entropy);
+    uint64_t total = FieldExactCountPlacements(oppField, count, budgetMicros, &complete);
+    if (!complete || total == 0 || total > UINT32_MAX)
+    {
+        return 0;
+    }
+
+    for (uint16_t p = 0; p < FIELD_NUM_PLACEMENTS; p++)
+    {
+        if (count[p] == 0)
+        {
+            continue;
+        }
+        FieldBitboard todo = FieldBitboardAnd(fieldPlacements[p].mask, unknown);
+        if (FieldEntropyIsSingle(todo))
+        {
+            entropy->sink[fieldPlacements[p].type][FieldBitboardFirst(todo)] += count[p];
+        }
+        while (todo)
+        {
+            entropy->cover[FieldBitboardPopFirst(&todo)] += count[p];
+        }
+    }
+    entropy->total = total;
+    return entropy->total;
+}
+
+/** FieldEntropySample(*entropy, *oppField, *rng, maxSamples, budgetMicros)
+ *
+ * @param   *entropy        Receives the counts.
+ * @param   *oppField       The opponent's field.
+ * @param   *rng            xorshift64* state.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldEntropySample(FieldEntropy *entropy, const Field *oppField, uint64_t *rng,
+                            uint32_t maxSamples, uint32_t budgetMicros)
+{
+    FieldSamplerCandidates c;
+    FieldEntropyTally cover = {{0}};
+    FieldEntropyTally sink[FIELD_NUM_BOATS] = {{{0}}};
+    uint16_t placement[FIELD_NUM_BOATS];
+    uint32_t start = FieldSamplerMicros();
+    uint32_t attempts = 0;
+    uint32_t pending = 0;
+
+    FieldEntropyClear(entropy);
+    if ((maxSamples == 0 && budgetMicros == 0) || !FieldSamplerPrepare(oppField, &c))
+    {
+        return 0;
+    }
+
+    uint32_t maxAttempts = UINT32_MAX;
+    if (maxSamples && maxSamples < UINT32_MAX / FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE)
+    {
+        maxAttempts = maxSamples * FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE;
+    }
+
+    while (attempts < maxAttempts)
+    {
+        if (maxSamples && entropy->total >= maxSamples)
+        {
+            break;
+        }
+        if (budgetMicros && attempts % FIELD_ENTROPY_CLOCK_STRIDE == 0 &&
+            FieldSamplerMicros() - start >= budgetMicros)
+        {
+            break;
+        }
+
+        attempts++;
+        FieldBitboard occupied = FieldSamplerDrawBoats(rng, &c, placement);
+        if (!occupied)
+        {
+            continue;
+        }
+
+        entropy->total++;
+        FieldEntropyTallyAdd(&cover, FieldBitboardAnd(occupied, c.unknown));
+        for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+        {
+            FieldBitboard left = FieldBitboardAnd(fieldPlacements[placement[type]].mask, c.unknown);
+            if (FieldEntropyIsSingle(left))
+            {
+                FieldEntropyTallyAdd(&sink[type], left);
+            }
+        }
+        if (++pending == FIELD_ENTROPY_TALLY_MAX)
+        {
+            FieldEntropyTallyFold(&cover, entropy->cover);
+            for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+            {
+                FieldEntropyTallyFold(&sink[type], entropy->sink[type]);
+            }
+            pending = 0;
+        }
+    }
+
+    FieldEntropyTallyFold(&cover, entropy->cover);
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        FieldEntropyTallyFold(&sink[type], entropy->sink[type]);
+    }
+    return entropy->total;
+}
+
+/** FieldEntropyBits(*entropy, square)
+ *
+ * The outcomes are a miss, a hit that sinks nothing, and one sinking per boat.
+ *
+ * @param   *entropy    Counts from FieldEntropyExact() or FieldEntropySample().
+ * @param   square      A square index.
+ * @return  The entropy in bits, with 12 fractional bits.
+ */
+uint32_t FieldEntropyBits(const FieldEntropy *entropy, uint8_t square)
+{
+    uint32_t total = entropy->total;
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    uint32_t hit = entropy->cover[square];
+    uint32_t bits = FieldEntropyTerm(total - hit, total);
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        uint32_t sunk = entropy->sink[type][square];
+        bits += FieldEntropyTerm(sunk, total);
+        hit -= sunk;
+    }
+    return bits + FieldEntropyTerm(hit, total);
+}
+
+/** FieldEntropyBestGuess(*entropy, *oppField)
+ *
+ * Scores each unknown square as P(hit) + FIELD_ENTROPY_INFO_WEIGHT / 256 *
+ * bits, both with 12 fractional bits, breaking ties by scan order.
+ *
+ * @param   *entropy    Counts for oppField.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyBestGuess(const FieldEntropy *entropy, const Field *oppField)
+{
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    if (entropy->total == 0 || !unknown)
+    {
+        return FieldDensityDecideGuess(oppField);
+    }
+
+    uint8_t best = FieldBitboardFirst(unknown);
+    uint32_t bestScore = 0;
+    FieldBitboard todo = unknown;
+    while (todo)
+    {
+        uint8_t i = FieldBitboardPopFirst(&todo);
+        uint32_t score = (uint32_t)(((uint64_t)entropy->cover[i] << 12) / entropy->total) +
+                ((FieldEntropyBits(entropy, i) * FIELD_ENTROPY_INFO_WEIGHT) >> 8);
+        if (score > bestScore)
+        {
+            best = i;
+            bestScore = score;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
+
+/** FieldEntropyDecideGuess(*oppField)
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyDecideGuess(const Field *oppField)
+{
+    return FieldEntropyDecideGuessRng(oppField, RngDefault());
+}
+
+/** FieldEntropyDecideGuessRng(*oppField, *rng)
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *rng        The generator.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldEntropyDecideGuessRng(const Field *oppField, Rng *rng)
+{
+    FieldEntropy entropy;
+
+    if (!FieldEntropyExact(&entropy, oppField, FIELD_ENTROPY_EXACT_BUDGET_US))
+    {
+        // The sampling stream is xorshift, which must not start at zero
+        uint64_t stream = RngNext(rng) | 1;
+        FieldEntropySample(&entropy, oppField, &stream, FIELD_SAMPLER_DEFAULT_SAMPLES,
+                           FIELD_SAMPLER_DEFAULT_BUDGET_US);
+    }
+    return FieldEntropyBestGuess(&entropy, oppField);
+}
@@ -0,0 +1,269 @@
+/**
+ * @file    FieldExact.c
+ *
+ * Exact solver for the opponent's field.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldExact.h"
+#include "FieldPlacement.h"
+#include "FieldSampler.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// How many next-to-last-level branches to take between clock reads
+#define FIELD_EXACT_CLOCK_STRIDE 256
+
+/**
+ * Working state for one solve. count[p] is the number of consistent
+ * configurations that use placement p.
+ */
+typedef struct {
+    const FieldSamplerCandidates *c;
+    uint8_t order[FIELD_NUM_BOATS];         // Boat types, fewest candidates first
+    uint8_t sizeAfter[FIELD_NUM_BOATS];     // Squares in the boats after each level
+    uint64_t *count;                        // FIELD_NUM_PLACEMENTS entries
+    uint32_t start;
+    uint32_t budgetMicros;                  // 0 when there is no time limit
+    uint16_t untilClock;                    // Branches left before the next clock read
+    uint8_t stopped;
+} FieldExactSearch;
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldExactCount(*s, level, occupied)
+ *
+ * Counts the ways to place the boats from `level` on, given the squares
+ * already occupied, and adds every completion to the placements that were used.
+ */
+static uint64_t FieldExactCount(FieldExactSearch *s, uint8_t level, FieldBitboard occupied)
+{
+    uint8_t type = s->order[level];
+    const uint16_t *index = s->c->index[type];
+    uint8_t n = s->c->count[type];
+    FieldBitboard uncovered = FieldBitboardAndNot(s->c->hits, occupied);
+    uint64_t total = 0;
+
+    if (s->stopped)
+    {
+        return 0;
+    }
+
+    // Last boat: it alone has to cover whatever hits are left
+    if (level == FIELD_NUM_BOATS - 1)
+    {
+        for (uint8_t i = 0; i < n; i++)
+        {
+            FieldBitboard mask = fieldPlacements[index[i]].mask;
+            if (FieldBitboardAnd(mask, occupied) || FieldBitboardAndNot(uncovered, mask))
+            {
+                continue;
+            }
+            s->count[index[i]]++;
+            total++;
+        }
+        return total;
+    }
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        FieldBitboard mask = fieldPlacements[index[i]].mask;
+        if (FieldBitboardAnd(mask, occupied))
+        {
+            continue;
+        }
+        // The boats still to come must be able to cover the remaining hits
+        if (FieldBitboardCount(FieldBitboardAndNot(uncovered, mask)) > s->sizeAfter[level])
+        {
+            continue;
+        }
+        if (s->budgetMicros && level == FIELD_NUM_BOATS - 2 && --s->untilClock == 0)
+        {
+            s->untilClock = FIELD_EXACT_CLOCK_STRIDE;
+            if (FieldAIMicros() - s->start >= s->budgetMicros)
+            {
+                s->stopped = 1;
+                return total;
+            }
+        }
+        uint64_t ways = FieldExactCount(s, level + 1, occupied | mask);
+        s->count[index[i]] += ways;
+        total += ways;
+    }
+    return total;
+}
+
+/*  PROTOTYPES  */
+
+/** FieldExactSolve(*exact, *oppField)
+ *
+ * Enumerates every fleet configuration consistent with oppField.
+ *
+ * @param   *exact      Receives the tallies.
+ * @param   *oppField   The opponent's field.
+ * @return  The number of consistent configurations, 0 if there are none.
+ */
+uint64_t FieldExactSolve(FieldExact *exact, const Field *oppField)
+{
+    return FieldExactSolveWithin(exact, oppField, 0);
+}
+
+/** FieldExactSolveWithin(*exact, *oppField, budgetMicros)
+ *
+ * FieldExactSolve() with a time limit.
+ *
+ * @param   *exact          Receives the tallies.
+ * @param   *oppField       The opponent's field.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @return  The number of configurations counted.
+ */
+uint64_t FieldExactSolveWithin(FieldExact *exact, const Field *oppField, uint32_t budgetMicros)
+{
+    uint64_t count[FIELD_NUM_PLACEMENTS];
+
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        exact->tally[i] = 0;
+    }
+    exact->total = FieldExactCountPlacements(oppField, count, budgetMicros, &exact->complete);
+
+    for (uint16_t p = 0; p < FIELD_NUM_PLACEMENTS; p++)
+    {
+        if (count[p] == 0)
+        {
+            continue;
+        }
+        FieldBitboard todo = fieldPlacements[p].mask;
+        while (todo)
+        {
+            exact->tally[FieldBitboardPopFirst(&todo)] += count[p];
+        }
+    }
+    return exact->total;
+}
+
+/** FieldExactCountPlacements(*oppField, count, budgetMicros, *complete)
+ *
+ * Counts the consistent configurations that use each placement.
+ *
+ * @param   *oppField       The opponent's field.
+ * @param   count           Output, indexed like fieldPlacements.
+ * @param   budgetMicros    Time limit in microseconds, or 0 for none.
+ * @param   *complete       Set to zero if the time limit was reached.
+ * @return  The number of configurations counted.
+ */
+uint64_t FieldExactCountPlacements(const Field *oppField, uint64_t count[FIELD_NUM_PLACEMENTS],
+                                   uint32_t budgetMicros, uint8_t *complete)
+{
+    FieldSamplerCandidates c;
+    FieldExactSearch s;
+
+    s.start = FieldAIMicros();
+    s.budgetMicros = budgetMicros;
+    s.untilClock = FIELD_EXACT_CLOCK_STRIDE;
+    s.stopped = 0;
+    s.count = count;
+
+    for (uint16_t p = 0; p < FIELD_NUM_PLACEMENTS; p++)
+    {
+        count[p] = 0;
+    }
+    *complete = 1;
+
+    if (!FieldSamplerPrepare(oppField, &c))
+    {
+        return 0;
+    }
+
+    // Branch on the most constrained boats first; the widest one is the leaf
+    s.c = &c;
+    for (uint8_t i = 0; i < FIELD_NUM_BOATS; i++)
+    {
+        uint8_t j = i;
+        while (j > 0 && c.count[s.order[j - 1]] > c.count[i])
+        {
+            s.order[j] = s.order[j - 1];
+            j--;
+        }
+        s.order[j] = i;
+    }
+    uint8_t size = 0;
+    for (int8_t level = FIELD_NUM_BOATS - 1; level >= 0; level--)
+    {
+        s.sizeAfter[level] = size;
+        size += fieldBoatSizes[s.order[level]];
+    }
+
+    uint64_t total = FieldExactCount(&s, 0, 0);
+    *complete = !s.stopped;
+    return total;
+}
+
+/** FieldExactProbabilities(*exact, prob)
+ *
+ * Converts the tallies of a solve into probabilities.
+ *
+ * @param   *exact      A result filled by FieldExactSolve().
+ * @param   prob        Output, indexed by FIELD_BITBOARD_INDEX(row, col).
+ */
+void FieldExactProbabilities(const FieldExact *exact, double prob[FIELD_NUM_SQUARES])
+{
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        prob[i] = exact->total ? (double)exact->tally[i] / exact->total : 0.0;
+    }
+}
+
+/** FieldExactBestGuess(*exact, *oppField)
+ *
+ * Picks the unknown square with the highest probability.
+ *
+ * @param   *exact      A result filled by FieldExactSolve().
+ * @param   *oppField   The same field that was solved.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldExactBestGuess(const FieldExact *exact, const Field *oppField)
+{
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    if (exact->total == 0 || !exact->complete || !unknown)
+    {
+        return FieldDensityDecideGuess(oppField);
+    }
+
+    uint8_t best = FieldBitboardFirst(unknown);
+    FieldBitboard todo = unknown;
+    while (todo)
+    {
+        uint8_t i = FieldBitboardPopFirst(&todo);
+        if (exact->tally[i] > exact->tally[best])
+        {
+            best = i;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
+
+/** FieldExactDecideGuess(*oppField)
+ *
+ * Solves oppField and returns the most likely unknown square.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldExactDecideGuess(const Field *oppField)
+{
+    FieldExact exact;
+    FieldExactSolve(&exact, oppField);
+    return FieldExactBestGuess(&exact, oppField);
+}
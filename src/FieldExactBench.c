@@ -0,0 +1,117 @@
+/**
+ * @file    FieldExactBench.c
+ *
+ * Measures the exact solver: enumeration time per board state at each stage
+ * of a game, the number of consistent configurations, and shots-to-win against
+ * the density engine.
+ *
+ * @usage   `$ ./FieldExact_bench [games] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldExact.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+#define DEFAULT_GAMES 50
+
+// Game stages are reported in bins of this many shots
+#define STAGE_SHOTS 10
+#define NUM_STAGES (FIELD_NUM_SQUARES / STAGE_SHOTS + 1)
+
+typedef struct {
+    uint64_t decisions;
+    uint64_t micros;
+    uint32_t worstMicros;
+    double configs;
+} StageStats;
+
+/**
+ * Plays one game with the given decision rule and returns the number of shots.
+ * When `stages` is non-NULL the exact solver shoots and its timings are
+ * recorded; otherwise the density engine shoots.
+ */
+static uint16_t PlayGame(const Field *layout, StageStats stages[NUM_STAGES])
+{
+    Field target = *layout;
+    Field knowledge;
+    FieldExact exact;
+    FieldInit(NULL, &knowledge);
+
+    uint16_t shots = 0;
+    while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+    {
+        GuessData guess;
+        if (stages)
+        {
+            uint32_t start = FieldSamplerMicros();
+            FieldExactSolve(&exact, &knowledge);
+            uint32_t elapsed = FieldSamplerMicros() - start;
+            guess = FieldExactBestGuess(&exact, &knowledge);
+
+            StageStats *stage = &stages[shots / STAGE_SHOTS];
+            stage->decisions++;
+            stage->micros += elapsed;
+            stage->configs += (double)exact.total;
+            if (elapsed > stage->worstMicros)
+            {
+                stage->worstMicros = elapsed;
+            }
+        }
+        else
+        {
+            guess = FieldDensityDecideGuess(&knowledge);
+        }
+        FieldRegisterEnemyAttack(&target, &guess);
+        FieldUpdateKnowledge(&knowledge, &guess);
+        shots++;
+    }
+    return shots;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t games = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_GAMES;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    StageStats stages[NUM_STAGES] = {{0}};
+    uint64_t densityShots = 0, exactShots = 0;
+
+    for (uint32_t g = 0; g < games; g++)
+    {
+        Field layout;
+        FieldInit(&layout, NULL);
+        FieldAIPlaceAllBoats(&layout);
+        densityShots += PlayGame(&layout, NULL);
+        exactShots += PlayGame(&layout, stages);
+    }
+
+    printf("=== FieldExact benchmark: %u games, seed %u ===\n", games, seed);
+    printf("avg shots: density %.2f, exact %.2f\n",
+           (double)densityShots / games, (double)exactShots / games);
+
+    printf("\n%-8s %10s %12s %12s %16s\n", "shots", "decisions", "avg us", "worst us", "avg configs");
+    for (int s = 0; s < NUM_STAGES; s++)
+    {
+        if (!stages[s].decisions)
+        {
+            continue;
+        }
+        printf("%2d-%-5d %10llu %12.1f %12u %16.0f\n",
+               s * STAGE_SHOTS, s * STAGE_SHOTS + STAGE_SHOTS - 1,
+               (unsigned long long)stages[s].decisions,
+               (double)stages[s].micros / stages[s].decisions,
+               stages[s].worstMicros,
+               stages[s].configs / stages[s].decisions);
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    FieldLayout.c
+ *
+ * Placement from the tuned layout table.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldLayout.h"
+#include "FieldPlacement.h"
+#include "Rng.h"
+
+/*  PROTOTYPES  */
+
+/** FieldLayoutPlace(*layout, *ownField)
+ *
+ * Adds the boats of one layout to ownField.
+ *
+ * @param   *layout     The layout to place.
+ * @param   *ownField   A field with no boats yet.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldLayoutPlace(const FieldLayout *layout, Field *ownField)
+{
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        const FieldPlacement *p = &fieldPlacements[layout->placement[type]];
+        if (p->type != type || !FieldAddBoat(ownField, p->row, p->col, p->dir, p->type))
+        {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+/** FieldAIPlaceAllBoatsTuned(*ownField)
+ *
+ * Places a layout drawn from fieldLayouts by weight.
+ *
+ * @param   *ownField   A field with no boats yet.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldAIPlaceAllBoatsTuned(Field *ownField)
+{
+    return FieldAIPlaceAllBoatsTunedRng(ownField, RngDefault());
+}
+
+/** FieldAIPlaceAllBoatsTunedRng(*ownField, *rng)
+ *
+ * @param   *ownField   A field with no boats yet.
+ * @param   *rng        The generator.
+ * @return  SUCCESS, or STANDARD_ERROR if a boat did not fit.
+ */
+uint8_t FieldAIPlaceAllBoatsTunedRng(Field *ownField, Rng *rng)
+{
+    uint16_t r = RngBelow(rng, fieldLayoutWeightTotal);
+    uint16_t i = 0;
+    while (r >= fieldLayouts[i].weight)
+    {
+        r -= fieldLayouts[i].weight;
+        i++;
+    }
+    return FieldLayoutPlace(&fieldLayouts[i], ownField);
+}
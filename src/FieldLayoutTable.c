@@ -0,0 +1,275 @@
+/**
+ * @file    FieldLayoutTable.c
+ *
+ * GENERATED by tools/FieldLayoutOpt.c -- do not edit by hand.
+ *
+ * 20000 candidates, 2000 evaluation games per arm, seed 1.
+ * Opponent shots-to-win, mean +/- 95% confidence interval:
+ *   parity               uniform 42.90 +/- 0.24   tuned 53.79 +/- 0.09
+ *   density              uniform 33.62 +/- 0.17   tuned 40.11 +/- 0.07
+ *   sampler (held out)   uniform 28.18 +/- 0.14   tuned 29.07 +/- 0.13
+ */
+#include <stdint.h>
+
+#include "FieldLayout.h"
+
+const uint16_t fieldLayoutWeightTotal = 1354;
+
+const FieldLayout fieldLayouts[FIELD_NUM_LAYOUTS] = {
+    {{ 12, 158, 175, 241}, 16},
+    {{ 33, 123, 206, 244}, 16},
+    {{ 19, 118, 198, 255}, 14},
+    {{ 79, 101, 213, 241}, 14},
+    {{ 15, 153, 209, 238}, 14},
+    {{ 79, 148, 200, 223}, 14},
+    {{  0, 141, 205, 228}, 14},
+    {{ 86, 121, 205, 236}, 12},
+    {{ 80, 123, 185, 244}, 12},
+    {{ 15, 159, 208, 241}, 12},
+    {{ 54, 110, 209, 243}, 12},
+    {{  0, 152, 204, 225}, 12},
+    {{ 79,  89, 210, 240}, 12},
+    {{ 17, 158, 181, 241}, 12},
+    {{ 80, 125, 187, 250}, 12},
+    {{ 86, 100, 193, 241}, 12},
+    {{ 79, 101, 212, 243}, 12},
+    {{ 79, 156, 165, 233}, 12},
+    {{ 71, 156, 190, 237}, 12},
+    {{ 86, 121, 204, 223}, 10},
+    {{ 80, 116, 208, 236}, 10},
+    {{ 18, 145, 212, 233}, 10},
+    {{ 67, 146, 214, 236}, 10},
+    {{ 79, 148, 187, 217}, 10},
+    {{ 53, 158, 204, 234}, 10},
+    {{ 37, 101, 211, 250}, 10},
+    {{ 53, 122, 214, 237}, 10},
+    {{ 80, 144, 209, 223}, 10},
+    {{ 19, 139, 197, 249}, 10},
+    {{ 81, 110, 215, 244}, 10},
+    {{ 54,  91, 201, 249}, 10},
+    {{ 80, 159, 199, 237}, 10},
+    {{ 72, 158, 208, 236}, 10},
+    {{ 79, 139, 187, 217}, 10},
+    {{  1, 156, 198, 228}, 10},
+    {{ 17, 158, 177, 244}, 10},
+    {{ 17, 139, 194, 250},  7},
+    {{ 79, 131, 177, 251},  7},
+    {{ 86, 125, 210, 223},  7},
+    {{ 79,  97, 212, 233},  7},
+    {{ 33, 123, 205, 245},  7},
+    {{ 71,  90, 187, 248},  7},
+    {{  3, 154, 209, 232},  7},
+    {{ 15, 153, 202, 237},  7},
+    {{ 33, 147, 203, 255},  7},
+    {{ 53,  95, 211, 231},  7},
+    {{ 86, 146, 197, 241},  7},
+    {{ 33,  88, 203, 254},  7},
+    {{ 85, 146, 174, 236},  7},
+    {{ 79, 108, 201, 252},  7},
+    {{ 87, 101, 211, 231},  7},
+    {{ 73, 151, 191, 221},  7},
+    {{ 39, 154, 197, 249},  7},
+    {{ 19, 114, 174, 241},  7},
+    {{ 19, 140, 205, 240},  7},
+    {{ 53, 105, 207, 243},  7},
+    {{ 39, 116, 167, 248},  7},
+    {{ 70, 116, 194, 247},  7},
+    {{ 15, 125, 187, 248},  7},
+    {{ 80, 101, 179, 248},  7},
+    {{ 19, 153, 208, 225},  7},
+    {{ 79, 139, 171, 231},  7},
+    {{ 20, 154, 181, 245},  7},
+    {{ 80, 133, 214, 233},  7},
+    {{  0, 156, 199, 240},  7},
+    {{ 81, 146, 209, 237},  7},
+    {{ 47, 139, 191, 248},  7},
+    {{ 35, 153, 167, 249},  7},
+    {{ 33, 152, 210, 244},  7},
+    {{ 87,  88, 196, 247},  7},
+    {{ 80, 116, 214, 223},  7},
+    {{ 73, 159, 179, 245},  7},
+    {{ 71, 154, 174, 233},  7},
+    {{ 19, 155, 173, 241},  7},
+    {{ 70, 156, 171, 241},  7},
+    {{ 79,  91, 198, 252},  7},
+    {{ 77, 138, 211, 237},  7},
+    {{  5, 139, 215, 235},  7},
+    {{ 85, 138, 198, 223},  7},
+    {{ 57, 159, 210, 240},  7},
+    {{ 79, 105, 212, 235},  7},
+    {{ 87, 127, 210, 233},  7},
+    {{  6,  90, 202, 250},  7},
+    {{ 80, 151, 179, 244},  5},
+    {{  1, 140, 197, 255},  5},
+    {{ 19, 135, 208, 251},  5},
+    {{ 80, 125, 209, 221},  5},
+    {{ 82, 107, 185, 245},  5},
+    {{ 86,  99, 192, 246},  5},
+    {{ 19, 152, 187, 243},  5},
+    {{ 71, 157, 171, 232},  5},
+    {{ 80, 149, 190, 233},  5},
+    {{ 86,  92, 210, 239},  5},
+    {{ 86, 101, 164, 239},  5},
+    {{  3, 152, 199, 253},  5},
+    {{  0, 151, 214, 240},  5},
+    {{ 87, 101, 181, 243},  5},
+    {{ 42, 157, 203, 216},  5},
+    {{ 54, 142, 207, 225},  5},
+    {{ 70, 148, 178, 223},  5},
+    {{ 71, 150, 210, 235},  5},
+    {{ 87, 135, 198, 247},  5},
+    {{  5, 145, 181, 248},  5},
+    {{ 80, 158, 163, 245},  5},
+    {{  9, 107, 213, 245},  5},
+    {{ 71, 154, 196, 247},  5},
+    {{ 86, 145, 196, 246},  5},
+    {{ 54,  91, 215, 243},  5},
+    {{ 79, 123, 177, 253},  5},
+    {{ 36, 143, 163, 252},  5},
+    {{ 79, 154, 183, 246},  5},
+    {{ 23, 148, 173, 241},  5},
+    {{ 86, 139, 167, 246},  5},
+    {{ 15,  89, 211, 250},  5},
+    {{ 71,  95, 176, 248},  5},
+    {{ 56, 112, 203, 254},  5},
+    {{  3, 151, 187, 253},  5},
+    {{ 80, 133, 207, 232},  5},
+    {{ 78, 101, 211, 239},  5},
+    {{  3, 154, 196, 250},  5},
+    {{ 19, 153, 197, 241},  5},
+    {{  9, 119, 213, 241},  5},
+    {{  5, 152, 181, 246},  5},
+    {{  1, 144, 169, 247},  5},
+    {{ 29, 158, 164, 245},  5},
+    {{ 79, 155, 183, 241},  5},
+    {{ 17, 114, 199, 250},  5},
+    {{ 33, 154, 206, 237},  5},
+    {{  9, 103, 200, 248},  5},
+    {{ 81, 159, 192, 235},  5},
+    {{ 13, 154, 209, 233},  5},
+    {{  5, 159, 205, 232},  5},
+    {{ 37, 151, 211, 223},  5},
+    {{ 32, 146, 214, 236},  5},
+    {{ 23, 153, 197, 241},  5},
+    {{  2, 153, 202, 250},  5},
+    {{ 71, 108, 167, 248},  5},
+    {{ 76, 135, 181, 251},  5},
+    {{ 33, 146, 167, 245},  5},
+    {{ 79, 154, 198, 225},  5},
+    {{ 79, 127, 169, 252},  5},
+    {{ 78, 125, 213, 225},  5},
+    {{ 53, 156, 178, 223},  5},
+    {{ 19, 101, 215, 239},  5},
+    {{  1, 139, 212, 228},  3},
+    {{ 19, 153, 165, 244},  3},
+    {{ 86, 125, 175, 247},  3},
+    {{ 53, 116, 210, 243},  3},
+    {{ 53, 116, 206, 236},  3},
+    {{ 85, 110, 174, 237},  3},
+    {{ 13, 154, 209, 234},  3},
+    {{  0, 152, 202, 251},  3},
+    {{ 59, 152, 212, 233},  3},
+    {{ 80, 142, 187, 249},  3},
+    {{ 29, 105, 209, 252},  3},
+    {{ 87, 147, 185, 242},  3},
+    {{ 87, 103, 183, 251},  3},
+    {{ 12, 125, 190, 246},  3},
+    {{ 37, 154, 179, 244},  3},
+    {{ 87, 148, 181, 240},  3},
+    {{ 72, 152, 169, 237},  3},
+    {{ 33, 147, 213, 245},  3},
+    {{ 79, 116, 212, 239},  3},
+    {{ 19,  99, 203, 253},  3},
+    {{ 72, 138, 208, 219},  3},
+    {{  5, 141, 187, 254},  3},
+    {{ 19, 104, 198, 239},  3},
+    {{ 80,  99, 209, 240},  3},
+    {{  5, 118, 203, 248},  3},
+    {{ 87,  93, 196, 244},  3},
+    {{ 55, 156, 183, 245},  3},
+    {{ 80, 116, 209, 219},  3},
+    {{ 21, 116, 215, 243},  3},
+    {{ 38,  93, 175, 244},  3},
+    {{ 73, 151, 177, 240},  3},
+    {{ 84, 138, 204, 239},  3},
+    {{ 33,  89, 202, 250},  3},
+    {{ 13, 110, 215, 242},  3},
+    {{ 80, 151, 179, 237},  3},
+    {{  5, 151, 213, 233},  3},
+    {{ 86, 133, 167, 241},  3},
+    {{ 77, 145, 210, 233},  3},
+    {{ 79, 147, 214, 235},  3},
+    {{ 11, 153, 203, 250},  3},
+    {{  5, 135, 181, 252},  3},
+    {{ 11, 155, 190, 236},  3},
+    {{ 82, 159, 199, 236},  3},
+    {{ 36, 138, 181, 248},  3},
+    {{ 15, 109, 212, 245},  3},
+    {{ 21, 156, 175, 242},  3},
+    {{ 81,  89, 185, 247},  3},
+    {{ 87, 155, 167, 240},  3},
+    {{  0,  99, 200, 255},  3},
+    {{  5, 155, 197, 235},  3},
+    {{  0, 152, 200, 240},  3},
+    {{ 79, 146, 214, 235},  3},
+    {{ 51, 151, 185, 241},  3},
+    {{ 86, 139, 187, 237},  3},
+    {{ 53,  93, 213, 238},  3},
+    {{ 13, 152, 162, 251},  3},
+    {{ 79, 153, 169, 237},  3},
+    {{ 72,  99, 203, 254},  3},
+    {{ 71, 108, 187, 252},  3},
+    {{ 87, 101, 210, 240},  3},
+    {{ 79, 118, 197, 252},  3},
+    {{ 39, 158, 165, 245},  3},
+    {{ 33, 146, 169, 245},  3},
+    {{ 17, 114, 215, 246},  3},
+    {{ 85, 135, 198, 236},  3},
+    {{ 74, 145, 185, 236},  3},
+    {{ 33, 152, 211, 231},  3},
+    {{ 27, 136, 161, 252},  3},
+    {{ 23, 122, 201, 253},  3},
+    {{ 49, 108, 199, 254},  3},
+    {{ 86, 140, 161, 240},  3},
+    {{ 83, 144, 175, 237},  3},
+    {{  5, 123, 210, 250},  3},
+    {{ 79, 131, 212, 233},  3},
+    {{ 37,  95, 214, 247},  3},
+    {{ 71, 122, 207, 239},  3},
+    {{ 87, 142, 197, 232},  3},
+    {{ 85, 116, 175, 237},  3},
+    {{ 80, 123, 187, 240},  3},
+    {{ 82, 144, 171, 231},  3},
+    {{ 19, 121, 214, 242},  3},
+    {{ 87,  89, 169, 247},  3},
+    {{  9, 152, 199, 236},  3},
+    {{ 51, 107, 167, 254},  3},
+    {{ 56, 152, 181, 238},  3},
+    {{ 79, 109, 213, 234},  3},
+    {{ 79, 105, 169, 252},  3},
+    {{ 79, 143, 212, 236},  3},
+    {{ 22, 107, 208, 223},  3},
+    {{  1,  97, 210, 242},  3},
+    {{ 79, 147, 187, 219},  3},
+    {{ 37, 106, 215, 240},  3},
+    {{ 33, 159, 204, 245},  3},
+    {{ 54, 158, 183, 238},  3},
+    {{  1, 110, 198, 228},  3},
+    {{ 17, 143, 210, 233},  3},
+    {{ 33, 149, 161, 245},  1},
+    {{ 78, 154, 181, 240},  1},
+    {{ 76, 138, 193, 251},  1},
+    {{ 49, 159, 192, 247},  1},
+    {{ 21, 151, 204, 240},  1},
+    {{ 79, 158, 197, 241},  1},
+    {{ 18, 138, 187, 247},  1},
+    {{ 86, 116, 176, 237},  1},
+    {{ 79, 118, 165, 251},  1},
+    {{ 78, 155, 195, 234},  1},
+    {{ 37, 101, 211, 245},  1},
+    {{ 79, 155, 205, 221},  1},
+    {{ 49, 153, 177, 255},  1},
+    {{ 79,  89, 183, 251},  1},
+    {{ 23, 155, 161, 245},  1},
+    {{ 79, 154, 177, 239},  1},
+};
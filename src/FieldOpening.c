@@ -0,0 +1,75 @@
+/**
+ * @file    FieldOpening.c
+ *
+ * Opening book lookup.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldOpening.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// FieldGetBoatStates() before any boat has sunk
+#define FIELD_OPENING_ALL_ALIVE ((1 << FIELD_NUM_BOATS) - 1)
+
+
+/*  PROTOTYPES  */
+
+/** FieldOpeningLookup(*oppField, *guess)
+ *
+ * Follows the book once per known square. Every step must land on a known
+ * square, so when the count of known squares matches the depth reached, the
+ * field holds exactly the book's shots.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *guess      Receives the book move.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpeningLookup(const Field *oppField, GuessData *guess)
+{
+    FieldBitboard hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    FieldBitboard misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    uint8_t shots = FieldBitboardCount(hits | misses);
+
+    if (shots >= FIELD_OPENING_DEPTH || FieldGetBoatStates(oppField) != FIELD_OPENING_ALL_ALIVE)
+    {
+        return STANDARD_ERROR;
+    }
+
+    uint16_t node = 0;
+    for (uint8_t depth = 0; depth < shots; depth++)
+    {
+        uint8_t square = fieldOpeningBook[node];
+        if (square == FIELD_OPENING_NONE)
+        {
+            return STANDARD_ERROR;
+        }
+        FieldBitboard bit = (FieldBitboard)1 << square;
+        if (misses & bit)
+        {
+            node = 2 * node + 1;
+        }
+        else if (hits & bit)
+        {
+            node = 2 * node + 2;
+        }
+        else
+        {
+            return STANDARD_ERROR;
+        }
+    }
+
+    uint8_t square = fieldOpeningBook[node];
+    if (square == FIELD_OPENING_NONE || ((hits | misses) & ((FieldBitboard)1 << square)))
+    {
+        return STANDARD_ERROR;
+    }
+    guess->row = FIELD_BITBOARD_ROW(square);
+    guess->col = FIELD_BITBOARD_COL(square);
+    guess->result = RESULT_MISS;
+    return SUCCESS;
+}
@@ -0,0 +1,30 @@
+/**
+ * @file    FieldOpeningTable.c
+ *
+ * GENERATED by tools/FieldOpeningGen.c -- do not edit by hand.
+ *
+ * Expected hits in the book's 8 shots: exact 5.558, density 5.458
+ * (per field on the book's path, against a uniformly placed fleet).
+ */
+#include <stdint.h>
+
+#include "FieldOpening.h"
+
+const uint8_t fieldOpeningBook[FIELD_OPENING_NODES] = {
+      4,  55,   5,  15,  54,   2,   3,  44,  14,  57,  53,  14,   3,   6,   6,  23,
+     45,  25,  13,  35,  56,  56,  56, 255,  24,  14,   1,  14,   7,   2,   2,  36,
+     24,  34,  46,  16,  35,  16,  16, 255,  45,  35,  58,  34,  57,  52,  52, 255,
+    255, 255,  34, 255,  24,  12,   0, 255,  15,  14,   8,  13,   1,   7,   7,  27,
+     35,  33,  25,  42,  24,  43,  43, 255,  17,  17,   5,  24,  17,  12,  17, 255,
+    255, 255,  25, 255,  45,  35,  59, 255,  35,  34,  58,  33,  51,  57,  57, 255,
+    255, 255, 255, 255, 255, 255,  44, 255, 255, 255,  34, 255,  13,  11, 255, 255,
+    255, 255,  24, 255,  15,  14,   9, 255,  14,  12,   0,  13,   8,   1,   1,  32,
+     28,  26,  34,  21,  13,  22,  26, 255,  43,  42,  54,  24,  42,  47,  42, 255,
+    255, 255,  18,   5,  16,  16,  45, 255,  25,  24,  18,  23,  11,  12,  12, 255,
+    255, 255, 255, 255, 255, 255,  15, 255, 255, 255,  25, 255,  36,  35, 255, 255,
+    255, 255,  44, 255,  35,  34,  59, 255,  34,  32,  50,  33,  58,  51,  51, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  54, 255,
+    255, 255, 255, 255, 255, 255,  44, 255, 255, 255,  14, 255,  12, 255, 255, 255,
+    255, 255, 255, 255, 255, 255,  25, 255, 255, 255,  16, 255,  15, 255, 255, 255,
+    255, 255,  15, 255,  13, 255, 255, 255,  14, 255,   9, 255,   0,   8,   8,
+};
@@ -0,0 +1,403 @@
+/**
+ * @file    FieldOpponent.c
+ *
+ * Per-opponent placement priors.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldOpponent.h"
+#include "FieldPlacement.h"
+
+#ifndef STM32F4
+#include <stdio.h>
+#endif
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldOpponentChecksum(*model)
+ *
+ * FNV-1a over every byte of the model before its checksum.
+ */
+static uint32_t FieldOpponentChecksum(const FieldOpponent *model)
+{
+    const uint8_t *bytes = (const uint8_t *)model;
+    uint32_t hash = 0x811C9DC5u;
+    for (size_t i = 0; i < offsetof(FieldOpponent, checksum); i++)
+    {
+        hash = (hash ^ bytes[i]) * 0x01000193u;
+    }
+    return hash;
+}
+
+/** FieldOpponentTotals(*model, total)
+ *
+ * Sums the counts of each boat type's placements.
+ */
+static void FieldOpponentTotals(const FieldOpponent *model, uint32_t total[FIELD_NUM_BOATS])
+{
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        total[type] = 0;
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            total[type] += model->count[p];
+        }
+    }
+}
+
+/** FieldOpponentScaleOf(*model, p, type, total)
+ *
+ * A placement's count against its type's average, both smoothed:
+ * (count + S) * n / (total + S * n).
+ */
+static uint32_t FieldOpponentScaleOf(const FieldOpponent *model, uint16_t p, uint8_t type,
+                                     uint32_t total)
+{
+    uint32_t n = fieldPlacementFirst[type + 1] - fieldPlacementFirst[type];
+    uint64_t num = ((uint64_t)model->count[p] + FIELD_OPPONENT_SMOOTHING) * n
+            << FIELD_OPPONENT_SCALE_BITS;
+    return (uint32_t)(num / (total + (uint64_t)FIELD_OPPONENT_SMOOTHING * n));
+}
+
+/** FieldOpponentWeight(mask, hits)
+ *
+ * FIELD_DENSITY_HIT_WEIGHT per covered hit, as in FieldDensity.c.
+ */
+static uint32_t FieldOpponentWeight(FieldBitboard mask, FieldBitboard hits)
+{
+    uint32_t weight = 1;
+    for (uint8_t h = FieldBitboardCount(FieldBitboardAnd(mask, hits)); h > 0; h--)
+    {
+        weight *= FIELD_DENSITY_HIT_WEIGHT;
+    }
+    return weight;
+}
+
+/** FieldOpponentAdd(*model, p, share)
+ *
+ * Adds share to one count, halving every count first if it would overflow.
+ */
+static void FieldOpponentAdd(FieldOpponent *model, uint16_t p, uint16_t share)
+{
+    if (model->count[p] > UINT16_MAX - share)
+    {
+        for (uint16_t i = 0; i < FIELD_NUM_PLACEMENTS; i++)
+        {
+            model->count[i] >>= 1;
+        }
+    }
+    model->count[p] += share;
+}
+
+/*  PROTOTYPES  */
+
+/** FieldOpponentInit(*model, id)
+ *
+ * @param   *model  The model.
+ * @param   id      Any number identifying the opponent.
+ */
+void FieldOpponentInit(FieldOpponent *model, uint32_t id)
+{
+    memset(model, 0, sizeof(*model));
+    model->magic = FIELD_OPPONENT_MAGIC;
+    model->version = FIELD_OPPONENT_VERSION;
+    model->numPlacements = FIELD_NUM_PLACEMENTS;
+    model->id = id;
+    model->checksum = FieldOpponentChecksum(model);
+}
+
+/** FieldOpponentCheck(*model)
+ *
+ * @param   *model  A model read from storage.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentCheck(const FieldOpponent *model)
+{
+    if (model->magic != FIELD_OPPONENT_MAGIC || model->version != FIELD_OPPONENT_VERSION ||
+        model->numPlacements != FIELD_NUM_PLACEMENTS ||
+        model->checksum != FieldOpponentChecksum(model))
+    {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+}
+
+/** FieldOpponentLearn(*model, *oppField, *state)
+ *
+ * A sunk boat lay on squares that were hit by the time it sank and covered
+ * the sinking square. FIELD_OPPONENT_UNIT is shared evenly among the
+ * placements that fit; a boat with more candidates than that is too
+ * ambiguous to learn from.
+ *
+ * @param   *model      The model.
+ * @param   *oppField   The player's final view of the opponent's field.
+ * @param   *state      The AI state that played the game, or NULL.
+ * @return  The number of boats learned from.
+ */
+uint8_t FieldOpponentLearn(FieldOpponent *model, const Field *oppField,
+                           const FieldAIState *state)
+{
+    FieldBitboard hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    uint8_t alive = FieldGetBoatStates(oppField);
+    uint8_t learned = 0;
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (alive & (1 << type))
+        {
+            continue;
+        }
+
+        FieldBitboard allowed = hits;
+        FieldBitboard required = 0;
+        if (state != NULL && state->sunkSquare[type] < FIELD_NUM_SQUARES)
+        {
+            allowed = FieldBitboardAnd(allowed, state->hitsAtSink[type]);
+            required = (FieldBitboard)1 << state->sunkSquare[type];
+        }
+
+        uint16_t candidates = 0;
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (!FieldBitboardAndNot(mask, allowed) && !FieldBitboardAndNot(required, mask))
+            {
+                candidates++;
+            }
+        }
+        if (candidates == 0 || candidates > FIELD_OPPONENT_UNIT)
+        {
+            continue;
+        }
+
+        uint16_t share = FIELD_OPPONENT_UNIT / candidates;
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (!FieldBitboardAndNot(mask, allowed) && !FieldBitboardAndNot(required, mask))
+            {
+                FieldOpponentAdd(model, p, share);
+            }
+        }
+        learned++;
+    }
+
+    if (learned > 0)
+    {
+        model->games++;
+    }
+    model->checksum = FieldOpponentChecksum(model);
+    return learned;
+}
+
+/** FieldOpponentScale(*model, placement)
+ *
+ * @param   *model      The model.
+ * @param   placement   An index into fieldPlacements.
+ * @return  The placement's prior scale, with FIELD_OPPONENT_SCALE_BITS
+ *          fractional bits.
+ */
+uint32_t FieldOpponentScale(const FieldOpponent *model, uint16_t placement)
+{
+    uint32_t total[FIELD_NUM_BOATS];
+    FieldOpponentTotals(model, total);
+    uint8_t type = fieldPlacements[placement].type;
+    return FieldOpponentScaleOf(model, placement, type, total[type]);
+}
+
+/** FieldOpponentDecideGuess(*model, *oppField)
+ *
+ * Fires at the unknown square with the highest prior-weighted density,
+ * breaking ties by scan order.
+ *
+ * @param   *model      The model, or NULL.
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldOpponentDecideGuess(const FieldOpponent *model, const Field *oppField)
+{
+    if (model == NULL)
+    {
+        return FieldDensityDecideGuess(oppField);
+    }
+
+    FieldBitboard misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    FieldBitboard hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    uint8_t alive = FieldGetBoatStates(oppField);
+    uint32_t total[FIELD_NUM_BOATS];
+    uint64_t density[FIELD_NUM_SQUARES] = {0};
+
+    FieldOpponentTotals(model, total);
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (!(alive & (1 << type)))
+        {
+            continue;
+        }
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (FieldBitboardAnd(mask, misses))
+            {
+                continue;
+            }
+            uint64_t weight = (uint64_t)FieldOpponentWeight(mask, hits) *
+                    FieldOpponentScaleOf(model, p, type, total[type]);
+            FieldBitboard todo = FieldBitboardAnd(mask, unknown);
+            while (todo)
+            {
+                density[FieldBitboardPopFirst(&todo)] += weight;
+            }
+        }
+    }
+
+    uint8_t best = FieldBitboardFirst(unknown);
+    if (best == FIELD_NUM_SQUARES)
+    {
+        // Nothing left to shoot at; any in-bounds square will do
+        best = 0;
+    }
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        if (density[i] > density[best])
+        {
+            best = i;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
+
+/** FieldOpponentSave(*model, *path)
+ *
+ * @param   *model  The model.
+ * @param   *path   The file to write.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentSave(FieldOpponent *model, const char *path)
+{
+#ifdef STM32F4
+    (void)model;
+    (void)path;
+    return STANDARD_ERROR;
+#else
+    model->checksum = FieldOpponentChecksum(model);
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        return STANDARD_ERROR;
+    }
+    size_t written = fwrite(model, sizeof(*model), 1, file);
+    if (fclose(file) != 0 || written != 1)
+    {
+        return STANDARD_ERROR;
+    }
+    return SUCCESS;
+#endif
+}
+
+/** FieldOpponentLoad(*model, *path)
+ *
+ * @param   *model  Receives the model.
+ * @param   *path   The file to read.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentLoad(FieldOpponent *model, const char *path)
+{
+#ifdef STM32F4
+    (void)model;
+    (void)path;
+    return STANDARD_ERROR;
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return STANDARD_ERROR;
+    }
+    size_t read = fread(model, sizeof(*model), 1, file);
+    fclose(file);
+    if (read != 1)
+    {
+        return STANDARD_ERROR;
+    }
+    return FieldOpponentCheck(model);
+#endif
+}
+
+/** FieldOpponentFlashSave(*model)
+ *
+ * @param   *model  The model.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentFlashSave(FieldOpponent *model)
+{
+#ifdef STM32F4
+    FLASH_EraseInitTypeDef erase;
+    uint32_t sectorError = 0;
+    const uint32_t *words = (const uint32_t *)model;
+    uint8_t status = SUCCESS;
+
+    // The end of the image in flash: code, then the initial values of .data.
+    // Refuse to erase a sector the image reaches.
+    extern uint32_t _sidata, _sdata, _edata;
+    uint32_t imageEnd = (uint32_t)&_sidata + ((uint32_t)&_edata - (uint32_t)&_sdata);
+    if (imageEnd > FIELD_OPPONENT_FLASH_ADDRESS)
+    {
+        return STANDARD_ERROR;
+    }
+
+    model->checksum = FieldOpponentChecksum(model);
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Sector = FIELD_OPPONENT_FLASH_SECTOR;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+    HAL_FLASH_Unlock();
+    if (HAL_FLASHEx_Erase(&erase, &sectorError) != HAL_OK)
+    {
+        status = STANDARD_ERROR;
+    }
+    for (uint32_t i = 0; status == SUCCESS && i < sizeof(*model) / sizeof(uint32_t); i++)
+    {
+        if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FIELD_OPPONENT_FLASH_ADDRESS + 4 * i,
+                              words[i]) != HAL_OK)
+        {
+            status = STANDARD_ERROR;
+        }
+    }
+    HAL_FLASH_Lock();
+    return status;
+#else
+    (void)model;
+    return STANDARD_ERROR;
+#endif
+}
+
+/** FieldOpponentFlashLoad(*model)
+ *
+ * @param   *model  Receives the model.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldOpponentFlashLoad(FieldOpponent *model)
+{
+#ifdef STM32F4
+    memcpy(model, (const void *)FIELD_OPPONENT_FLASH_ADDRESS, sizeof(*model));
+    return FieldOpponentCheck(model);
+#else
+    (void)model;
+    return STANDARD_ERROR;
+#endif
+}
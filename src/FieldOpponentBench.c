@@ -0,0 +1,213 @@
+/**
+ * @file    FieldOpponentBench.c
+ *
+ * Plays the "model" policy against opponents with a habit and reports how many
+ * shots it needs as its FieldOpponent prior fills in, next to the plain
+ * "density" policy on the same fleets. Each opponent gets a fresh model that
+ * learns from every game in turn, as the Agent does between games.
+ *
+ * The opponents are:
+ *   uniform    FieldAIPlaceAllBoatsUniform(), the control: nothing to learn
+ *   tuned      FieldAIPlaceAllBoatsTuned(), a small committed layout table
+ *   edges      boats along the border whenever they fit there
+ *   fixed      one of FIXED_LAYOUTS random layouts, chosen each game
+ *
+ * The last model learned is written to a file, read back and checked, which
+ * also reports the size of the stored model.
+ *
+ * @usage   `$ ./FieldOpponent_bench [games] [seed] [model file]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldLayout.h"
+#include "FieldOpponent.h"
+#include "FieldPlacement.h"
+#include "FieldPolicy.h"
+#include "Rng.h"
+
+#define DEFAULT_GAMES 2000
+#define DEFAULT_MODEL_FILE "FieldOpponent_bench.bbom"
+#define FIXED_LAYOUTS 4
+#define EDGE_TRIES 64
+
+typedef uint8_t (*PlaceFunction)(Field *ownField, Rng *rng);
+
+typedef struct {
+    const char *name;
+    PlaceFunction place;
+} Opponent;
+
+static Field fixedLayouts[FIXED_LAYOUTS];
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * Places each boat, largest first, on a random free placement that lies on the
+ * border of the field, falling back to any free placement.
+ */
+static uint8_t PlaceEdges(Field *ownField, Rng *rng)
+{
+    FieldBitboard border = 0;
+    for (uint8_t row = 0; row < FIELD_ROWS; row++)
+    {
+        for (uint8_t col = 0; col < FIELD_COLS; col++)
+        {
+            if (row == 0 || row == FIELD_ROWS - 1 || col == 0 || col == FIELD_COLS - 1)
+            {
+                border |= FIELD_BITBOARD_SQUARE(row, col);
+            }
+        }
+    }
+
+    FieldInit(ownField, NULL);
+    for (int8_t type = FIELD_NUM_BOATS - 1; type >= 0; type--)
+    {
+        uint16_t first = fieldPlacementFirst[type];
+        uint16_t count = fieldPlacementFirst[type + 1] - first;
+        uint8_t placed = 0;
+        for (uint16_t tries = 0; !placed && tries < EDGE_TRIES * 4; tries++)
+        {
+            const FieldPlacement *p = &fieldPlacements[first + RngBelow(rng, count)];
+            if (tries < EDGE_TRIES && FieldBitboardAndNot(p->mask, border))
+            {
+                continue;
+            }
+            placed = FieldAddBoat(ownField, p->row, p->col, p->dir, p->type) == SUCCESS;
+        }
+        if (!placed)
+        {
+            return STANDARD_ERROR;
+        }
+    }
+    return SUCCESS;
+}
+
+static uint8_t PlaceFixed(Field *ownField, Rng *rng)
+{
+    *ownField = fixedLayouts[RngBelow(rng, FIXED_LAYOUTS)];
+    return SUCCESS;
+}
+
+static const Opponent opponents[] = {
+    {"uniform", FieldAIPlaceAllBoatsUniformRng},
+    {"tuned", FieldAIPlaceAllBoatsTunedRng},
+    {"edges", PlaceEdges},
+    {"fixed", PlaceFixed},
+};
+
+/**
+ * Plays `policy` alone against a copy of `layout`, calling finish() at the
+ * end. Returns the number of shots it needed to sink every boat.
+ */
+static uint16_t ShotsToWin(const FieldPolicy *policy, FieldPolicyState *state,
+                           const Field *layout, uint64_t *nanos)
+{
+    Field target = *layout;
+    Field knowledge;
+    FieldInit(NULL, &knowledge);
+    policy->reset(state, &knowledge);
+
+    uint16_t shots = 0;
+    while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+    {
+        uint64_t start = NowNanos();
+        GuessData guess = policy->decide(state, &knowledge);
+        *nanos += NowNanos() - start;
+
+        FieldRegisterEnemyAttack(&target, &guess);
+        FieldUpdateKnowledge(&knowledge, &guess);
+        policy->observe(state, &knowledge, &guess);
+        shots++;
+    }
+    if (policy->finish != NULL)
+    {
+        policy->finish(state, &knowledge);
+    }
+    return shots;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t games = (argc > 1) ? (uint32_t)atoi(argv[1]) : DEFAULT_GAMES;
+    uint32_t seed = (argc > 2) ? (uint32_t)atoi(argv[2]) : (uint32_t)time(NULL);
+    const char *path = (argc > 3) ? argv[3] : DEFAULT_MODEL_FILE;
+    const FieldPolicy *density = FieldPolicyFind("density");
+    const FieldPolicy *model = FieldPolicyFind("model");
+    FieldPolicyState densityState, modelState;
+    FieldOpponent opponent;
+    Rng rng;
+
+    if (games < 4)
+    {
+        games = 4;
+    }
+    RngSeed(&rng, seed);
+    RngSeed(RngDefault(), seed);
+    for (uint8_t i = 0; i < FIXED_LAYOUTS; i++)
+    {
+        FieldInit(&fixedLayouts[i], NULL);
+        FieldAIPlaceAllBoatsRng(&fixedLayouts[i], &rng);
+    }
+
+    printf("FieldOpponent benchmark: %u games per opponent, seed %u\n\n", games, seed);
+    printf("%-10s %10s %10s %12s %12s %12s\n", "opponent", "density", "model",
+           "model 1st q", "model 4th q", "us/shot");
+
+    for (uint8_t o = 0; o < sizeof(opponents) / sizeof(opponents[0]); o++)
+    {
+        uint64_t densityShots = 0, modelShots = 0, quarterShots[4] = {0, 0, 0, 0};
+        uint64_t densityNanos = 0, modelNanos = 0;
+
+        FieldOpponentInit(&opponent, o);
+        FieldPolicyStateInit(&densityState, &rng);
+        FieldPolicyStateInit(&modelState, &rng);
+        modelState.user = &opponent;
+
+        for (uint32_t g = 0; g < games; g++)
+        {
+            Field layout;
+            FieldInit(&layout, NULL);
+            if (opponents[o].place(&layout, &rng) != SUCCESS)
+            {
+                printf("%s failed to place a fleet\n", opponents[o].name);
+                return 1;
+            }
+            densityShots += ShotsToWin(density, &densityState, &layout, &densityNanos);
+            uint16_t shots = ShotsToWin(model, &modelState, &layout, &modelNanos);
+            modelShots += shots;
+            quarterShots[(uint64_t)g * 4 / games] += shots;
+        }
+
+        uint32_t quarter = games / 4;
+        printf("%-10s %10.2f %10.2f %12.2f %12.2f %5.2f / %-5.2f\n", opponents[o].name,
+               (double)densityShots / games, (double)modelShots / games,
+               (double)quarterShots[0] / quarter, (double)quarterShots[3] / (games - 3 * quarter),
+               densityNanos / 1e3 / densityShots, modelNanos / 1e3 / modelShots);
+    }
+
+    // Round-trip the last model through the storage format
+    FieldOpponent loaded;
+    if (FieldOpponentSave(&opponent, path) != SUCCESS ||
+        FieldOpponentLoad(&loaded, path) != SUCCESS ||
+        memcmp(&loaded, &opponent, sizeof(opponent)) != 0)
+    {
+        printf("\nFailed to save and reload the model as %s\n", path);
+        return 1;
+    }
+    printf("\nSaved the last model as %s: %u bytes, %u games\n", path,
+           (unsigned)sizeof(loaded), loaded.games);
+    return 0;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file    FieldPacked.c
+ *
+ * Nibble-packed field storage.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldPacked.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+#define FIELD_PACKED_NIBBLE_MASK 0xFull
+
+// The lowest bit of every nibble in a word
+#define FIELD_PACKED_LOW_BITS 0x1111111111111111ull
+
+
+/*  PRIVATE FUNCTIONS   */
+
+static uint8_t FieldPackedGet(const FieldPacked *packed, uint8_t nibble)
+{
+    return (packed->word[nibble / 16] >> (4 * (nibble % 16))) & FIELD_PACKED_NIBBLE_MASK;
+}
+
+static void FieldPackedPut(FieldPacked *packed, uint8_t nibble, uint8_t value)
+{
+    uint8_t shift = 4 * (nibble % 16);
+    uint64_t *word = &packed->word[nibble / 16];
+    *word = (*word & ~(FIELD_PACKED_NIBBLE_MASK << shift)) |
+            ((uint64_t)(value & FIELD_PACKED_NIBBLE_MASK) << shift);
+}
+
+/**
+ * Moves bit 4k of a word to bit k, for k = 0..15, and drops the others.
+ */
+static uint16_t FieldPackedGather(uint64_t bits)
+{
+    bits &= FIELD_PACKED_LOW_BITS;
+    bits = (bits | (bits >> 3)) & 0x0303030303030303ull;
+    bits = (bits | (bits >> 6)) & 0x000F000F000F000Full;
+    bits = (bits | (bits >> 12)) & 0x000000FF000000FFull;
+    bits = (bits | (bits >> 24)) & 0x000000000000FFFFull;
+    return (uint16_t)bits;
+}
+
+
+/*  PROTOTYPES  */
+
+/** FieldPack(*packed, *f)
+ *
+ * @param   *packed The packed field to fill.
+ * @param   *f      The field to pack.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldPack(FieldPacked *packed, const Field *f)
+{
+    const uint8_t lives[FIELD_NUM_BOATS] = {
+        f->smallBoatLives, f->mediumBoatLives, f->largeBoatLives, f->hugeBoatLives
+    };
+    uint8_t result = SUCCESS;
+    uint8_t types = 0;
+
+    // The boat table is not packed, which only loses nothing with one boat of
+    // each type: its boats then sink with their type
+    for (uint8_t id = 0; id < f->numBoats; id++)
+    {
+        if (id >= FIELD_NUM_BOATS || f->boatType[id] >= FIELD_NUM_BOATS ||
+            (types & (1 << f->boatType[id])))
+        {
+            result = STANDARD_ERROR;
+            break;
+        }
+        types |= 1 << f->boatType[id];
+    }
+
+    for (uint8_t w = 0; w < FIELD_PACKED_WORDS; w++)
+    {
+        packed->word[w] = 0;
+    }
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        uint8_t status = f->grid[FIELD_BITBOARD_ROW(i)][FIELD_BITBOARD_COL(i)];
+        if (status > FIELD_PACKED_NIBBLE_MASK)
+        {
+            result = STANDARD_ERROR;
+        }
+        packed->word[i / 16] |= (uint64_t)(status & FIELD_PACKED_NIBBLE_MASK) << (4 * (i % 16));
+    }
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (lives[type] > FIELD_PACKED_MAX_LIVES)
+        {
+            result = STANDARD_ERROR;
+        }
+        FieldPackedPut(packed, FIELD_NUM_SQUARES + type, lives[type]);
+    }
+    return result;
+}
+
+/** FieldUnpack(*f, *packed)
+ *
+ * @param   *f      The field to fill.
+ * @param   *packed The packed field.
+ */
+void FieldUnpack(Field *f, const FieldPacked *packed)
+{
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        f->grid[FIELD_BITBOARD_ROW(i)][FIELD_BITBOARD_COL(i)] = FieldPackedGet(packed, i);
+    }
+    f->smallBoatLives = FieldPackedGet(packed, FIELD_NUM_SQUARES + FIELD_BOAT_TYPE_SMALL);
+    f->mediumBoatLives = FieldPackedGet(packed, FIELD_NUM_SQUARES + FIELD_BOAT_TYPE_MEDIUM);
+    f->largeBoatLives = FieldPackedGet(packed, FIELD_NUM_SQUARES + FIELD_BOAT_TYPE_LARGE);
+    f->hugeBoatLives = FieldPackedGet(packed, FIELD_NUM_SQUARES + FIELD_BOAT_TYPE_HUGE);
+    f->numBoats = 0;    // No boat table: FieldPack() only packs one boat per type
+    FieldSyncBitboards(f);
+}
+
+/** FieldPackedGetSquareStatus(*packed, row, col)
+ *
+ * @param   *packed The packed field.
+ * @param   row     The row-component of the location to retrieve
+ * @param   col     The column-component of the location to retrieve
+ * @return  The status of the square, or FIELD_SQUARE_INVALID.
+ */
+SquareStatus FieldPackedGetSquareStatus(const FieldPacked *packed, uint8_t row, uint8_t col)
+{
+    if (row >= FIELD_ROWS || col >= FIELD_COLS)
+    {
+        return FIELD_SQUARE_INVALID;
+    }
+    return (SquareStatus)FieldPackedGet(packed, FIELD_BITBOARD_INDEX(row, col));
+}
+
+/** FieldPackedSetSquareStatus(*packed, row, col, p)
+ *
+ * @param   *packed The packed field.
+ * @param   row     The row-component of the location to modify.
+ * @param   col     The column-component of the location to modify.
+ * @param   p       The new value of the field location.
+ * @return  The old value at that field location, or FIELD_SQUARE_INVALID.
+ */
+SquareStatus FieldPackedSetSquareStatus(FieldPacked *packed, uint8_t row, uint8_t col,
+                                        SquareStatus p)
+{
+    if (row >= FIELD_ROWS || col >= FIELD_COLS)
+    {
+        return FIELD_SQUARE_INVALID;
+    }
+    uint8_t index = FIELD_BITBOARD_INDEX(row, col);
+    SquareStatus old = (SquareStatus)FieldPackedGet(packed, index);
+    FieldPackedPut(packed, index, p);
+    return old;
+}
+
+/** FieldPackedGetBoatStates(*packed)
+ *
+ * @param   *packed The packed field.
+ * @return  The boats still afloat, as FieldGetBoatStates() gives them.
+ */
+uint8_t FieldPackedGetBoatStates(const FieldPacked *packed)
+{
+    uint8_t status = 0;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        if (FieldPackedGet(packed, FIELD_NUM_SQUARES + type))
+        {
+            status |= 1 << type;
+        }
+    }
+    return status;
+}
+
+/** FieldPackedGetBitboard(*packed, p)
+ *
+ * XORing a word with p in every nibble leaves zero nibbles where the square
+ * holds p. Folding each nibble onto its low bit then marks the others.
+ *
+ * @param   *packed The packed field.
+ * @param   p       The status to look up.
+ * @return  A bitboard of all squares with status p.
+ */
+FieldBitboard FieldPackedGetBitboard(const FieldPacked *packed, SquareStatus p)
+{
+    FieldBitboard board = 0;
+
+    if ((unsigned)p > FIELD_PACKED_NIBBLE_MASK)
+    {
+        return 0;
+    }
+    uint64_t pattern = FIELD_PACKED_LOW_BITS * (uint64_t)p;
+    for (uint8_t w = 0; w < FIELD_PACKED_WORDS; w++)
+    {
+        uint64_t x = packed->word[w] ^ pattern;
+        x |= x >> 1;
+        x |= x >> 2;
+        uint16_t matches = (uint16_t)~FieldPackedGather(x);
+        if (w < 4)
+        {
+            board |= (FieldBitboard)matches << (16 * w);
+        }
+    }
+    return board & FIELD_BITBOARD_ALL;
+}
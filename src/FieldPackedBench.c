@@ -0,0 +1,185 @@
+/**
+ * @file    FieldPackedBench.c
+ *
+ * Compares a population of Field boards with the same boards as FieldPacked,
+ * the way a batch simulator holds them: each board is a fleet with some shots
+ * already taken. Three passes run over every board:
+ *   scan       hits so far and boats afloat, in memory order
+ *   shoot      one shot at a random square of each board, in random order
+ *   round trip FieldUnpack() and FieldPack() (packed boards only)
+ * Both populations must agree on every scan, which checks the packed queries
+ * as a side effect.
+ *
+ * @usage   `$ ./FieldPacked_bench [boards] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldPacked.h"
+#include "Rng.h"
+
+#define DEFAULT_BOARDS 1000000
+#define OPENING_SHOTS 20
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint64_t ScanFields(const Field *fields, uint32_t boards)
+{
+    uint64_t sum = 0;
+    for (uint32_t b = 0; b < boards; b++)
+    {
+        sum += FieldBitboardCount(FieldGetBitboard(&fields[b], FIELD_SQUARE_HIT));
+        sum += FieldGetBoatStates(&fields[b]);
+    }
+    return sum;
+}
+
+static uint64_t ScanPacked(const FieldPacked *packed, uint32_t boards)
+{
+    uint64_t sum = 0;
+    for (uint32_t b = 0; b < boards; b++)
+    {
+        sum += FieldBitboardCount(FieldPackedGetBitboard(&packed[b], FIELD_SQUARE_HIT));
+        sum += FieldPackedGetBoatStates(&packed[b]);
+    }
+    return sum;
+}
+
+/**
+ * Marks a boat square as hit and an empty one as missed, as
+ * FieldRegisterEnemyAttack() would without the lives.
+ */
+static uint8_t Shoot(SquareStatus status)
+{
+    if (status >= FIELD_SQUARE_SMALL_BOAT && status <= FIELD_SQUARE_HUGE_BOAT)
+    {
+        return FIELD_SQUARE_HIT;
+    }
+    return (status == FIELD_SQUARE_EMPTY) ? FIELD_SQUARE_MISS : status;
+}
+
+static void ShootFields(Field *fields, const uint32_t *order, const uint8_t *squares,
+                        uint32_t boards)
+{
+    for (uint32_t i = 0; i < boards; i++)
+    {
+        Field *f = &fields[order[i]];
+        uint8_t row = FIELD_BITBOARD_ROW(squares[i]), col = FIELD_BITBOARD_COL(squares[i]);
+        FieldSetSquareStatus(f, row, col, Shoot(FieldGetSquareStatus(f, row, col)));
+    }
+}
+
+static void ShootPacked(FieldPacked *packed, const uint32_t *order, const uint8_t *squares,
+                        uint32_t boards)
+{
+    for (uint32_t i = 0; i < boards; i++)
+    {
+        FieldPacked *p = &packed[order[i]];
+        uint8_t row = FIELD_BITBOARD_ROW(squares[i]), col = FIELD_BITBOARD_COL(squares[i]);
+        FieldPackedSetSquareStatus(p, row, col, Shoot(FieldPackedGetSquareStatus(p, row, col)));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t boards = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_BOARDS;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    Field *fields = malloc(sizeof(Field) * boards);
+    FieldPacked *packed = malloc(sizeof(FieldPacked) * boards);
+    uint32_t *order = malloc(sizeof(uint32_t) * boards);
+    uint8_t *squares = malloc(boards);
+    Rng rng;
+
+    if (!fields || !packed || !order || !squares || boards == 0)
+    {
+        printf("Could not allocate %u boards\n", boards);
+        return 1;
+    }
+    RngSeed(&rng, seed);
+
+    // A fleet and a few shots per board
+    for (uint32_t b = 0; b < boards; b++)
+    {
+        FieldInit(&fields[b], NULL);
+        FieldAIPlaceAllBoatsRng(&fields[b], &rng);
+        for (uint8_t s = 0; s < OPENING_SHOTS; s++)
+        {
+            GuessData guess;
+            uint8_t square = (uint8_t)RngBelow(&rng, FIELD_NUM_SQUARES);
+            guess.row = FIELD_BITBOARD_ROW(square);
+            guess.col = FIELD_BITBOARD_COL(square);
+            FieldRegisterEnemyAttack(&fields[b], &guess);
+        }
+        if (FieldPack(&packed[b], &fields[b]) != SUCCESS)
+        {
+            printf("Board %u does not pack\n", b);
+            return 1;
+        }
+        order[b] = b;
+        squares[b] = (uint8_t)RngBelow(&rng, FIELD_NUM_SQUARES);
+    }
+    for (uint32_t b = boards - 1; b > 0; b--)
+    {
+        uint32_t j = RngBelow(&rng, b + 1);
+        uint32_t t = order[b];
+        order[b] = order[j];
+        order[j] = t;
+    }
+
+    printf("=== FieldPacked benchmark: %u boards, seed %u ===\n", boards, seed);
+    printf("%-12s %12s %12s\n", "", "Field", "FieldPacked");
+    printf("%-12s %12u %12u\n", "bytes/board", (unsigned)sizeof(Field),
+           (unsigned)sizeof(FieldPacked));
+    printf("%-12s %12.1f %12.1f\n", "MB", sizeof(Field) * (double)boards / 1e6,
+           sizeof(FieldPacked) * (double)boards / 1e6);
+
+    uint64_t start = NowNanos();
+    uint64_t fieldSum = ScanFields(fields, boards);
+    uint64_t fieldScan = NowNanos() - start;
+    start = NowNanos();
+    uint64_t packedSum = ScanPacked(packed, boards);
+    uint64_t packedScan = NowNanos() - start;
+    printf("%-12s %9.2f ns %9.2f ns\n", "scan", (double)fieldScan / boards,
+           (double)packedScan / boards);
+
+    start = NowNanos();
+    ShootFields(fields, order, squares, boards);
+    uint64_t fieldShoot = NowNanos() - start;
+    start = NowNanos();
+    ShootPacked(packed, order, squares, boards);
+    uint64_t packedShoot = NowNanos() - start;
+    printf("%-12s %9.2f ns %9.2f ns\n", "shoot", (double)fieldShoot / boards,
+           (double)packedShoot / boards);
+
+    start = NowNanos();
+    for (uint32_t b = 0; b < boards; b++)
+    {
+        Field f;
+        FieldUnpack(&f, &packed[b]);
+        FieldPack(&packed[b], &f);
+    }
+    uint64_t roundTrip = NowNanos() - start;
+    printf("%-12s %12s %9.2f ns\n", "round trip", "-", (double)roundTrip / boards);
+
+    // The shots must have landed the same way on both
+    uint8_t agree = fieldSum == packedSum &&
+            ScanFields(fields, boards) == ScanPacked(packed, boards);
+    printf("\nScans %s\n", agree ? "agree" : "DISAGREE");
+
+    free(fields);
+    free(packed);
+    free(order);
+    free(squares);
+    return agree ? 0 : 1;
+}
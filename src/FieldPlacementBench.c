@@ -0,0 +1,140 @@
+/**
+ * @file    FieldPlacementBench.c
+ *
+ * Compares ways of placing the AI's own fleet: the original retry loop, the
+ * rejection-free FieldAIPlaceAllBoats() and FieldAIPlaceAllBoatsUniform().
+ * Reports fleets placed per second, the retries the original loop needed, and
+ * how far each method's square coverage is from the exact uniform coverage
+ * computed by FieldExactSolve().
+ *
+ * @usage   `$ ./FieldPlacement_bench [fleets] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldExact.h"
+#include "FieldPlacement.h"
+#include "Rng.h"
+
+#define DEFAULT_FLEETS 200000
+
+typedef uint8_t (*PlaceFunction)(Field *ownField);
+
+static uint64_t legacyRetries[FIELD_NUM_BOATS];
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * The placement loop FieldAIPlaceAllBoats() used to run: draw any row, column
+ * and direction and retry until FieldAddBoat() accepts. Counts the retries.
+ */
+static uint8_t LegacyPlaceAllBoats(Field *ownField)
+{
+    BoatType boatTypes[] = {
+        FIELD_BOAT_TYPE_HUGE,
+        FIELD_BOAT_TYPE_LARGE,
+        FIELD_BOAT_TYPE_MEDIUM,
+        FIELD_BOAT_TYPE_SMALL};
+
+    for (uint8_t i = 0; i < FIELD_NUM_BOATS; i++)
+    {
+        uint8_t row = RngBelow(RngDefault(), FIELD_ROWS);
+        uint8_t col = RngBelow(RngDefault(), FIELD_COLS);
+        BoatDirection dir = (RngBelow(RngDefault(), 2) == 0) ? FIELD_DIR_SOUTH : FIELD_DIR_EAST;
+
+        while (!(FieldAddBoat(ownField, row, col, dir, boatTypes[i])))
+        {
+            legacyRetries[boatTypes[i]]++;
+            row = RngBelow(RngDefault(), FIELD_ROWS);
+            col = RngBelow(RngDefault(), FIELD_COLS);
+            dir = (RngBelow(RngDefault(), 2) == 0) ? FIELD_DIR_SOUTH : FIELD_DIR_EAST;
+        }
+    }
+
+    return SUCCESS;
+}
+
+/**
+ * Places `fleets` fleets with `place` and returns the time taken. Square
+ * coverage counts are accumulated into `covered`.
+ */
+static uint64_t Run(PlaceFunction place, uint32_t fleets, uint64_t covered[FIELD_NUM_SQUARES])
+{
+    uint64_t nanos = 0;
+    for (uint32_t f = 0; f < fleets; f++)
+    {
+        Field field;
+        FieldInit(&field, NULL);
+        uint64_t start = NowNanos();
+        place(&field);
+        nanos += NowNanos() - start;
+
+        FieldBitboard boats = FieldBitboardAndNot(FIELD_BITBOARD_ALL, FieldGetBitboard(&field, FIELD_SQUARE_EMPTY));
+        while (boats)
+        {
+            covered[FieldBitboardPopFirst(&boats)]++;
+        }
+    }
+    return nanos;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t fleets = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_FLEETS;
+    unsigned seed = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    // Exact per-square coverage over all fleets, and the uniform mode's
+    // expected number of fleet draws per success
+    Field empty;
+    FieldExact exact;
+    FieldInit(NULL, &empty);
+    FieldExactSolve(&exact, &empty);
+    double drawn = 1.0;
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        drawn *= fieldPlacementFirst[type + 1] - fieldPlacementFirst[type];
+    }
+    drawn /= (double)exact.total;
+
+    const char *names[] = {"retry loop", "rejection-free", "uniform"};
+    PlaceFunction places[] = {LegacyPlaceAllBoats, FieldAIPlaceAllBoats, FieldAIPlaceAllBoatsUniform};
+
+    printf("=== FieldPlacement benchmark: %u fleets, seed %u ===\n", fleets, seed);
+    printf("%-16s %14s %12s %22s\n", "method", "fleets/s", "ns/fleet", "max coverage error");
+    for (int m = 0; m < 3; m++)
+    {
+        uint64_t covered[FIELD_NUM_SQUARES] = {0};
+        uint64_t nanos = Run(places[m], fleets, covered);
+
+        double worst = 0;
+        for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+        {
+            double diff = (double)covered[i] / fleets - (double)exact.tally[i] / exact.total;
+            worst = diff > worst ? diff : (-diff > worst ? -diff : worst);
+        }
+        printf("%-16s %14.0f %12.1f %21.4f\n", names[m],
+               fleets * 1e9 / (nanos ? nanos : 1), (double)nanos / fleets, worst);
+    }
+
+    printf("\nretry loop retries per fleet: huge %.2f, large %.2f, medium %.2f, small %.2f\n",
+           (double)legacyRetries[FIELD_BOAT_TYPE_HUGE] / fleets,
+           (double)legacyRetries[FIELD_BOAT_TYPE_LARGE] / fleets,
+           (double)legacyRetries[FIELD_BOAT_TYPE_MEDIUM] / fleets,
+           (double)legacyRetries[FIELD_BOAT_TYPE_SMALL] / fleets);
+    printf("uniform mode fleets drawn per success (exact): %.3f of %llu configurations\n",
+           drawn, (unsigned long long)exact.total);
+
+    return 0;
+}
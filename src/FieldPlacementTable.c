@@ -0,0 +1,319 @@
+/**
+ * @file    FieldPlacementTable.c
+ *
+ * GENERATED by tools/FieldPlacementGen.c -- do not edit by hand.
+ * Regenerate with `make src/FieldPlacementTable.c`.
+ */
+#include <stdint.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+#if FIELD_ROWS != 6 || FIELD_COLS != 10
+#error "FieldPlacementTable.c was generated for a 6x10 field; regenerate it."
+#endif
+
+const uint8_t fieldBoatSizes[FIELD_NUM_BOATS] = {3, 4, 5, 6};
+
+const FieldPlacement fieldPlacements[FIELD_NUM_PLACEMENTS] = {
+    {0x0000000000100401ull, 0, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000000007ull, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000200802ull, 0, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000000000000eull, 0, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000401004ull, 0, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000000000001cull, 0, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000802008ull, 0, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000000038ull, 0, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000001004010ull, 0, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000000070ull, 0, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000002008020ull, 0, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x00000000000000e0ull, 0, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000004010040ull, 0, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x00000000000001c0ull, 0, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000008020080ull, 0, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000000380ull, 0, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000010040100ull, 0, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000020080200ull, 0, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000040100400ull, 1, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000001c00ull, 1, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000080200800ull, 1, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000003800ull, 1, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000100401000ull, 1, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000007000ull, 1, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000200802000ull, 1, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000000000e000ull, 1, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000401004000ull, 1, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000000001c000ull, 1, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000802008000ull, 1, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000038000ull, 1, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000001004010000ull, 1, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000070000ull, 1, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000002008020000ull, 1, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x00000000000e0000ull, 1, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000004010040000ull, 1, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000008020080000ull, 1, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000010040100000ull, 2, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000700000ull, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000020080200000ull, 2, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000000e00000ull, 2, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000040100400000ull, 2, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000001c00000ull, 2, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000080200800000ull, 2, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000003800000ull, 2, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000100401000000ull, 2, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000007000000ull, 2, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000200802000000ull, 2, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000000e000000ull, 2, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000401004000000ull, 2, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000001c000000ull, 2, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000802008000000ull, 2, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000038000000ull, 2, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0001004010000000ull, 2, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0002008020000000ull, 2, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0004010040000000ull, 3, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x00000001c0000000ull, 3, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0008020080000000ull, 3, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000380000000ull, 3, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0010040100000000ull, 3, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000700000000ull, 3, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0020080200000000ull, 3, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000e00000000ull, 3, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0040100400000000ull, 3, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000001c00000000ull, 3, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0080200800000000ull, 3, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000003800000000ull, 3, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0100401000000000ull, 3, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000007000000000ull, 3, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0200802000000000ull, 3, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x000000e000000000ull, 3, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0401004000000000ull, 3, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0802008000000000ull, 3, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL},
+    {0x0000070000000000ull, 4, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x00000e0000000000ull, 4, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x00001c0000000000ull, 4, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000380000000000ull, 4, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000700000000000ull, 4, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000e00000000000ull, 4, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0001c00000000000ull, 4, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0003800000000000ull, 4, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x001c000000000000ull, 5, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0038000000000000ull, 5, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0070000000000000ull, 5, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x00e0000000000000ull, 5, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x01c0000000000000ull, 5, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0380000000000000ull, 5, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0700000000000000ull, 5, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0e00000000000000ull, 5, 7, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL},
+    {0x0000000040100401ull, 0, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000000000full, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000080200802ull, 0, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000000001eull, 0, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000100401004ull, 0, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000000003cull, 0, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000200802008ull, 0, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000000000078ull, 0, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000401004010ull, 0, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000000000000f0ull, 0, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000802008020ull, 0, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000000000001e0ull, 0, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000001004010040ull, 0, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000000000003c0ull, 0, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000002008020080ull, 0, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000004010040100ull, 0, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000008020080200ull, 0, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000010040100400ull, 1, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000000003c00ull, 1, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000020080200800ull, 1, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000000007800ull, 1, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000040100401000ull, 1, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000000f000ull, 1, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000080200802000ull, 1, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000001e000ull, 1, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000100401004000ull, 1, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000003c000ull, 1, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000200802008000ull, 1, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000000078000ull, 1, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000401004010000ull, 1, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000000000f0000ull, 1, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000802008020000ull, 1, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0001004010040000ull, 1, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0002008020080000ull, 1, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0004010040100000ull, 2, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000000f00000ull, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0008020080200000ull, 2, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000001e00000ull, 2, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0010040100400000ull, 2, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000003c00000ull, 2, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0020080200800000ull, 2, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000007800000ull, 2, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0040100401000000ull, 2, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000000f000000ull, 2, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0080200802000000ull, 2, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000001e000000ull, 2, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0100401004000000ull, 2, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000003c000000ull, 2, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0200802008000000ull, 2, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0401004010000000ull, 2, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0802008020000000ull, 2, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000003c0000000ull, 3, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000780000000ull, 3, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000000f00000000ull, 3, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000001e00000000ull, 3, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000003c00000000ull, 3, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000007800000000ull, 3, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x000000f000000000ull, 3, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00000f0000000000ull, 4, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00001e0000000000ull, 4, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00003c0000000000ull, 4, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000780000000000ull, 4, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000f00000000000ull, 4, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0001e00000000000ull, 4, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0003c00000000000ull, 4, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x003c000000000000ull, 5, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0078000000000000ull, 5, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x00f0000000000000ull, 5, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x01e0000000000000ull, 5, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x03c0000000000000ull, 5, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0780000000000000ull, 5, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0f00000000000000ull, 5, 6, FIELD_DIR_EAST, FIELD_BOAT_TYPE_MEDIUM},
+    {0x0000010040100401ull, 0, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000000001full, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000020080200802ull, 0, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000000003eull, 0, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000040100401004ull, 0, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000000007cull, 0, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000080200802008ull, 0, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x00000000000000f8ull, 0, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000100401004010ull, 0, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x00000000000001f0ull, 0, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000200802008020ull, 0, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x00000000000003e0ull, 0, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000401004010040ull, 0, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0000802008020080ull, 0, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0001004010040100ull, 0, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0002008020080200ull, 0, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0004010040100400ull, 1, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0000000000007c00ull, 1, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0008020080200800ull, 1, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000000f800ull, 1, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0010040100401000ull, 1, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000001f000ull, 1, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0020080200802000ull, 1, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000003e000ull, 1, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0040100401004000ull, 1, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000007c000ull, 1, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0080200802008000ull, 1, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x00000000000f8000ull, 1, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0100401004010000ull, 1, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0200802008020000ull, 1, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0401004010040000ull, 1, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0802008020080000ull, 1, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_LARGE},
+    {0x0000000001f00000ull, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000000003e00000ull, 2, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000000007c00000ull, 2, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x000000000f800000ull, 2, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x000000001f000000ull, 2, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x000000003e000000ull, 2, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x00000007c0000000ull, 3, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000000f80000000ull, 3, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000001f00000000ull, 3, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000003e00000000ull, 3, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000007c00000000ull, 3, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x000000f800000000ull, 3, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x00001f0000000000ull, 4, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x00003e0000000000ull, 4, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x00007c0000000000ull, 4, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0000f80000000000ull, 4, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0001f00000000000ull, 4, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0003e00000000000ull, 4, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x007c000000000000ull, 5, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x00f8000000000000ull, 5, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x01f0000000000000ull, 5, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x03e0000000000000ull, 5, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x07c0000000000000ull, 5, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0f80000000000000ull, 5, 5, FIELD_DIR_EAST, FIELD_BOAT_TYPE_LARGE},
+    {0x0004010040100401ull, 0, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000000003full, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0008020080200802ull, 0, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000000007eull, 0, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0010040100401004ull, 0, 2, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x00000000000000fcull, 0, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0020080200802008ull, 0, 3, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x00000000000001f8ull, 0, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0040100401004010ull, 0, 4, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x00000000000003f0ull, 0, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0080200802008020ull, 0, 5, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x0100401004010040ull, 0, 6, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x0200802008020080ull, 0, 7, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x0401004010040100ull, 0, 8, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x0802008020080200ull, 0, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000000fc00ull, 1, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000001f800ull, 1, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000003f000ull, 1, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000007e000ull, 1, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x00000000000fc000ull, 1, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000000003f00000ull, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000000007e00000ull, 2, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000000fc00000ull, 2, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000001f800000ull, 2, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000003f000000ull, 2, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000000fc0000000ull, 3, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000001f80000000ull, 3, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000003f00000000ull, 3, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000007e00000000ull, 3, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x000000fc00000000ull, 3, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x00003f0000000000ull, 4, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x00007e0000000000ull, 4, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0000fc0000000000ull, 4, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0001f80000000000ull, 4, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0003f00000000000ull, 4, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x00fc000000000000ull, 5, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x01f8000000000000ull, 5, 1, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x03f0000000000000ull, 5, 2, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x07e0000000000000ull, 5, 3, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+    {0x0fc0000000000000ull, 5, 4, FIELD_DIR_EAST, FIELD_BOAT_TYPE_HUGE},
+};
+
+const uint16_t fieldPlacementFirst[FIELD_NUM_BOATS + 1] = {0, 88, 160, 216, 256};
+
+const FieldBitboard fieldPlacementMasks[FIELD_NUM_BOATS][FIELD_ROWS][FIELD_COLS][2] = {
+    { // FIELD_BOAT_TYPE_SMALL
+        {{0x100401ull, 0x7ull}, {0x200802ull, 0xeull}, {0x401004ull, 0x1cull}, {0x802008ull, 0x38ull}, {0x1004010ull, 0x70ull}, {0x2008020ull, 0xe0ull}, {0x4010040ull, 0x1c0ull}, {0x8020080ull, 0x380ull}, {0x10040100ull, 0x0ull}, {0x20080200ull, 0x0ull}},
+        {{0x40100400ull, 0x1c00ull}, {0x80200800ull, 0x3800ull}, {0x100401000ull, 0x7000ull}, {0x200802000ull, 0xe000ull}, {0x401004000ull, 0x1c000ull}, {0x802008000ull, 0x38000ull}, {0x1004010000ull, 0x70000ull}, {0x2008020000ull, 0xe0000ull}, {0x4010040000ull, 0x0ull}, {0x8020080000ull, 0x0ull}},
+        {{0x10040100000ull, 0x700000ull}, {0x20080200000ull, 0xe00000ull}, {0x40100400000ull, 0x1c00000ull}, {0x80200800000ull, 0x3800000ull}, {0x100401000000ull, 0x7000000ull}, {0x200802000000ull, 0xe000000ull}, {0x401004000000ull, 0x1c000000ull}, {0x802008000000ull, 0x38000000ull}, {0x1004010000000ull, 0x0ull}, {0x2008020000000ull, 0x0ull}},
+        {{0x4010040000000ull, 0x1c0000000ull}, {0x8020080000000ull, 0x380000000ull}, {0x10040100000000ull, 0x700000000ull}, {0x20080200000000ull, 0xe00000000ull}, {0x40100400000000ull, 0x1c00000000ull}, {0x80200800000000ull, 0x3800000000ull}, {0x100401000000000ull, 0x7000000000ull}, {0x200802000000000ull, 0xe000000000ull}, {0x401004000000000ull, 0x0ull}, {0x802008000000000ull, 0x0ull}},
+        {{0x0ull, 0x70000000000ull}, {0x0ull, 0xe0000000000ull}, {0x0ull, 0x1c0000000000ull}, {0x0ull, 0x380000000000ull}, {0x0ull, 0x700000000000ull}, {0x0ull, 0xe00000000000ull}, {0x0ull, 0x1c00000000000ull}, {0x0ull, 0x3800000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x1c000000000000ull}, {0x0ull, 0x38000000000000ull}, {0x0ull, 0x70000000000000ull}, {0x0ull, 0xe0000000000000ull}, {0x0ull, 0x1c0000000000000ull}, {0x0ull, 0x380000000000000ull}, {0x0ull, 0x700000000000000ull}, {0x0ull, 0xe00000000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+    },
+    { // FIELD_BOAT_TYPE_MEDIUM
+        {{0x40100401ull, 0xfull}, {0x80200802ull, 0x1eull}, {0x100401004ull, 0x3cull}, {0x200802008ull, 0x78ull}, {0x401004010ull, 0xf0ull}, {0x802008020ull, 0x1e0ull}, {0x1004010040ull, 0x3c0ull}, {0x2008020080ull, 0x0ull}, {0x4010040100ull, 0x0ull}, {0x8020080200ull, 0x0ull}},
+        {{0x10040100400ull, 0x3c00ull}, {0x20080200800ull, 0x7800ull}, {0x40100401000ull, 0xf000ull}, {0x80200802000ull, 0x1e000ull}, {0x100401004000ull, 0x3c000ull}, {0x200802008000ull, 0x78000ull}, {0x401004010000ull, 0xf0000ull}, {0x802008020000ull, 0x0ull}, {0x1004010040000ull, 0x0ull}, {0x2008020080000ull, 0x0ull}},
+        {{0x4010040100000ull, 0xf00000ull}, {0x8020080200000ull, 0x1e00000ull}, {0x10040100400000ull, 0x3c00000ull}, {0x20080200800000ull, 0x7800000ull}, {0x40100401000000ull, 0xf000000ull}, {0x80200802000000ull, 0x1e000000ull}, {0x100401004000000ull, 0x3c000000ull}, {0x200802008000000ull, 0x0ull}, {0x401004010000000ull, 0x0ull}, {0x802008020000000ull, 0x0ull}},
+        {{0x0ull, 0x3c0000000ull}, {0x0ull, 0x780000000ull}, {0x0ull, 0xf00000000ull}, {0x0ull, 0x1e00000000ull}, {0x0ull, 0x3c00000000ull}, {0x0ull, 0x7800000000ull}, {0x0ull, 0xf000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0xf0000000000ull}, {0x0ull, 0x1e0000000000ull}, {0x0ull, 0x3c0000000000ull}, {0x0ull, 0x780000000000ull}, {0x0ull, 0xf00000000000ull}, {0x0ull, 0x1e00000000000ull}, {0x0ull, 0x3c00000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x3c000000000000ull}, {0x0ull, 0x78000000000000ull}, {0x0ull, 0xf0000000000000ull}, {0x0ull, 0x1e0000000000000ull}, {0x0ull, 0x3c0000000000000ull}, {0x0ull, 0x780000000000000ull}, {0x0ull, 0xf00000000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+    },
+    { // FIELD_BOAT_TYPE_LARGE
+        {{0x10040100401ull, 0x1full}, {0x20080200802ull, 0x3eull}, {0x40100401004ull, 0x7cull}, {0x80200802008ull, 0xf8ull}, {0x100401004010ull, 0x1f0ull}, {0x200802008020ull, 0x3e0ull}, {0x401004010040ull, 0x0ull}, {0x802008020080ull, 0x0ull}, {0x1004010040100ull, 0x0ull}, {0x2008020080200ull, 0x0ull}},
+        {{0x4010040100400ull, 0x7c00ull}, {0x8020080200800ull, 0xf800ull}, {0x10040100401000ull, 0x1f000ull}, {0x20080200802000ull, 0x3e000ull}, {0x40100401004000ull, 0x7c000ull}, {0x80200802008000ull, 0xf8000ull}, {0x100401004010000ull, 0x0ull}, {0x200802008020000ull, 0x0ull}, {0x401004010040000ull, 0x0ull}, {0x802008020080000ull, 0x0ull}},
+        {{0x0ull, 0x1f00000ull}, {0x0ull, 0x3e00000ull}, {0x0ull, 0x7c00000ull}, {0x0ull, 0xf800000ull}, {0x0ull, 0x1f000000ull}, {0x0ull, 0x3e000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x7c0000000ull}, {0x0ull, 0xf80000000ull}, {0x0ull, 0x1f00000000ull}, {0x0ull, 0x3e00000000ull}, {0x0ull, 0x7c00000000ull}, {0x0ull, 0xf800000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x1f0000000000ull}, {0x0ull, 0x3e0000000000ull}, {0x0ull, 0x7c0000000000ull}, {0x0ull, 0xf80000000000ull}, {0x0ull, 0x1f00000000000ull}, {0x0ull, 0x3e00000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x7c000000000000ull}, {0x0ull, 0xf8000000000000ull}, {0x0ull, 0x1f0000000000000ull}, {0x0ull, 0x3e0000000000000ull}, {0x0ull, 0x7c0000000000000ull}, {0x0ull, 0xf80000000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+    },
+    { // FIELD_BOAT_TYPE_HUGE
+        {{0x4010040100401ull, 0x3full}, {0x8020080200802ull, 0x7eull}, {0x10040100401004ull, 0xfcull}, {0x20080200802008ull, 0x1f8ull}, {0x40100401004010ull, 0x3f0ull}, {0x80200802008020ull, 0x0ull}, {0x100401004010040ull, 0x0ull}, {0x200802008020080ull, 0x0ull}, {0x401004010040100ull, 0x0ull}, {0x802008020080200ull, 0x0ull}},
+        {{0x0ull, 0xfc00ull}, {0x0ull, 0x1f800ull}, {0x0ull, 0x3f000ull}, {0x0ull, 0x7e000ull}, {0x0ull, 0xfc000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x3f00000ull}, {0x0ull, 0x7e00000ull}, {0x0ull, 0xfc00000ull}, {0x0ull, 0x1f800000ull}, {0x0ull, 0x3f000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0xfc0000000ull}, {0x0ull, 0x1f80000000ull}, {0x0ull, 0x3f00000000ull}, {0x0ull, 0x7e00000000ull}, {0x0ull, 0xfc00000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0x3f0000000000ull}, {0x0ull, 0x7e0000000000ull}, {0x0ull, 0xfc0000000000ull}, {0x0ull, 0x1f80000000000ull}, {0x0ull, 0x3f00000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+        {{0x0ull, 0xfc000000000000ull}, {0x0ull, 0x1f8000000000000ull}, {0x0ull, 0x3f0000000000000ull}, {0x0ull, 0x7e0000000000000ull}, {0x0ull, 0xfc0000000000000ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}, {0x0ull, 0x0ull}},
+    },
+};
+
+const FieldBitboard fieldHuntLattices[FIELD_NUM_BOATS][FIELD_HUNT_MAX_SPACING] = {
+    {0x0249249249249249ull, 0x0492492492492492ull, 0x0924924924924924ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull}, // FIELD_BOAT_TYPE_SMALL
+    {0x0221118884422111ull, 0x0446221108844622ull, 0x0888442211188844ull, 0x0110884462211088ull, 0x0000000000000000ull, 0x0000000000000000ull}, // FIELD_BOAT_TYPE_MEDIUM
+    {0x0084422110884021ull, 0x0108844221008442ull, 0x0211088402110884ull, 0x0422100844221108ull, 0x0840211088442210ull, 0x0000000000000000ull}, // FIELD_BOAT_TYPE_LARGE
+    {0x0209048201008041ull, 0x0412080402010482ull, 0x0820100804120904ull, 0x0040201048241208ull, 0x0080412090482010ull, 0x0104824120804020ull}, // FIELD_BOAT_TYPE_HUGE
+};
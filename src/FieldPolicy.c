@@ -0,0 +1,311 @@
+/**
+ * @file    FieldPolicy.c
+ *
+ * The built-in policies and the registry.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCache.h"
+#include "FieldDensity.h"
+#include "FieldEntropy.h"
+#include "FieldExact.h"
+#include "FieldLayout.h"
+#include "FieldOpening.h"
+#include "FieldOpponent.h"
+#include "FieldPolicy.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+/*  PRIVATE FUNCTIONS   */
+
+static uint8_t FieldPolicyPlaceRandom(FieldPolicyState *state, Field *ownField)
+{
+    return FieldAIPlaceAllBoatsRng(ownField, &state->rng);
+}
+
+static uint8_t FieldPolicyPlaceUniform(FieldPolicyState *state, Field *ownField)
+{
+    return FieldAIPlaceAllBoatsUniformRng(ownField, &state->rng);
+}
+
+static uint8_t FieldPolicyPlaceTuned(FieldPolicyState *state, Field *ownField)
+{
+    return FieldAIPlaceAllBoatsTunedRng(ownField, &state->rng);
+}
+
+static GuessData FieldPolicyDecideStock(FieldPolicyState *state, const Field *oppField)
+{
+    return FieldAIStateDecideGuess(&state->ai, oppField);
+}
+
+static GuessData FieldPolicyDecideDensity(FieldPolicyState *state, const Field *oppField)
+{
+    (void)state;
+    return FieldDensityDecideGuess(oppField);
+}
+
+static GuessData FieldPolicyDecideMap(FieldPolicyState *state, const Field *oppField)
+{
+    FieldDensityMapUpdate(&state->map, oppField);
+    return FieldDensityMapBestGuess(&state->map, oppField);
+}
+
+static GuessData FieldPolicyDecideSampler(FieldPolicyState *state, const Field *oppField)
+{
+    FieldSamplerRun(&state->sampler, oppField, state->samples, state->budgetMicros);
+    return FieldSamplerBestGuess(&state->sampler, oppField);
+}
+
+static GuessData FieldPolicyDecideModel(FieldPolicyState *state, const Field *oppField)
+{
+    return FieldOpponentDecideGuess(state->user, oppField);
+}
+
+#ifndef STM32F4
+// The cache, and the policies that use it, are host only: on the Nucleo a
+// full solve does not fit in a shot, and the firmware leaves out FieldCache.c
+// and FieldEntropy.c
+
+/**
+ * Looks up the state's cache, if it has one, for an analysis of oppField.
+ * Sets *key for a later FieldPolicyCacheStore().
+ */
+static uint8_t FieldPolicyCacheLookup(FieldPolicyState *state, const Field *oppField,
+                                      FieldCacheKind kind, uint64_t *key, GuessData *guess)
+{
+    FieldCacheEntry entry;
+    *key = FieldCacheKey(oppField, kind);
+    if (state->cache == NULL ||
+        FieldCacheLookup(state->cache, *key, &entry, &state->cacheStats) != SUCCESS)
+    {
+        return STANDARD_ERROR;
+    }
+    *guess = FieldCacheGuess(&entry);
+    return SUCCESS;
+}
+
+/**
+ * Stores a guess and the counts behind it in the state's cache, if it has one.
+ */
+static void FieldPolicyCacheStore(FieldPolicyState *state, uint64_t key, const GuessData *guess,
+                                  const uint64_t count[FIELD_NUM_SQUARES], uint64_t total)
+{
+    FieldCacheEntry entry;
+    if (state->cache == NULL || total == 0)
+    {
+        return;
+    }
+    entry.square = FIELD_BITBOARD_INDEX(guess->row, guess->col);
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        entry.prob[i] = (uint8_t)((count[i] * 255 + total / 2) / total);
+    }
+    FieldCacheStore(state->cache, key, &entry, &state->cacheStats);
+}
+
+static GuessData FieldPolicyDecideExact(FieldPolicyState *state, const Field *oppField)
+{
+    FieldExact exact;
+    GuessData guess;
+    uint64_t key;
+    if (FieldOpeningLookup(oppField, &guess) == SUCCESS ||
+        FieldPolicyCacheLookup(state, oppField, FIELD_CACHE_EXACT, &key, &guess) == SUCCESS)
+    {
+        return guess;
+    }
+    FieldExactSolve(&exact, oppField);
+    guess = FieldExactBestGuess(&exact, oppField);
+    FieldPolicyCacheStore(state, key, &guess, exact.tally, exact.total);
+    return guess;
+}
+
+static GuessData FieldPolicyDecideEntropy(FieldPolicyState *state, const Field *oppField)
+{
+    FieldEntropy entropy;
+    GuessData guess;
+    uint64_t key;
+    if (FieldPolicyCacheLookup(state, oppField, FIELD_CACHE_ENTROPY, &key, &guess) == SUCCESS)
+    {
+        return guess;
+    }
+    if (FieldEntropyExact(&entropy, oppField, FIELD_ENTROPY_EXACT_BUDGET_US))
+    {
+        // Only complete counts are cached; samples differ from run to run
+        uint64_t cover[FIELD_NUM_SQUARES];
+        guess = FieldEntropyBestGuess(&entropy, oppField);
+        for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+        {
+            cover[i] = entropy.cover[i];
+        }
+        FieldPolicyCacheStore(state, key, &guess, cover, entropy.total);
+        return guess;
+    }
+    FieldEntropySample(&entropy, oppField, &state->sampler.rng, state->samples,
+                       state->budgetMicros);
+    return FieldEntropyBestGuess(&entropy, oppField);
+}
+#endif
+
+static GuessData FieldPolicyDecideAnytime(FieldPolicyState *state, const Field *oppField)
+{
+    return FieldAIDecideGuessWithin(oppField, &state->ai,
+                                    FieldAIMicros() + state->deadlineMicros, NULL);
+}
+
+static void FieldPolicyObserve(FieldPolicyState *state, const Field *oppField,
+                               const GuessData *ownGuess)
+{
+    (void)oppField;
+    FieldAIStateUpdate(&state->ai, ownGuess);
+}
+
+static void FieldPolicyReset(FieldPolicyState *state, const Field *oppField)
+{
+    (void)oppField;
+    FieldAIStateInitRng(&state->ai, &state->rng);
+}
+
+static void FieldPolicyFinishModel(FieldPolicyState *state, const Field *oppField)
+{
+    if (state->user != NULL)
+    {
+        FieldOpponentLearn(state->user, oppField, &state->ai);
+#ifdef STM32F4
+        // Keep what was learned across power-ups; this stalls about a second
+        FieldOpponentFlashSave(state->user);
+#endif
+    }
+}
+
+static void FieldPolicyResetMap(FieldPolicyState *state, const Field *oppField)
+{
+    FieldPolicyReset(state, oppField);
+    FieldDensityMapInit(&state->map, oppField);
+}
+
+static void FieldPolicyResetSampler(FieldPolicyState *state, const Field *oppField)
+{
+    FieldPolicyReset(state, oppField);
+    FieldSamplerInit(&state->sampler, RngNext(&state->rng));
+}
+
+
+/*  TABLES  */
+
+static const FieldPolicy fieldPolicyBuiltins[] = {
+    {"stock", "parity scan, then chases hits",
+     FieldPolicyPlaceRandom, FieldPolicyDecideStock, FieldPolicyObserve, FieldPolicyReset, NULL},
+    {"density", "placement density, rebuilt each shot",
+     FieldPolicyPlaceRandom, FieldPolicyDecideDensity, FieldPolicyObserve, FieldPolicyReset, NULL},
+    {"map", "placement density, updated incrementally",
+     FieldPolicyPlaceRandom, FieldPolicyDecideMap, FieldPolicyObserve, FieldPolicyResetMap, NULL},
+    {"sampler", "Monte Carlo posterior",
+     FieldPolicyPlaceRandom, FieldPolicyDecideSampler, FieldPolicyObserve, FieldPolicyResetSampler, NULL},
+#ifndef STM32F4
+    {"exact", "exact posterior (host only)",
+     FieldPolicyPlaceRandom, FieldPolicyDecideExact, FieldPolicyObserve, FieldPolicyReset, NULL},
+#endif
+    {"anytime", "density, exact or sampled within a deadline",
+     FieldPolicyPlaceRandom, FieldPolicyDecideAnytime, FieldPolicyObserve, FieldPolicyReset, NULL},
+    {"uniform", "stock hunting, uniform fleet placement",
+     FieldPolicyPlaceUniform, FieldPolicyDecideStock, FieldPolicyObserve, FieldPolicyReset, NULL},
+    {"tuned", "stock hunting, tuned fleet layouts",
+     FieldPolicyPlaceTuned, FieldPolicyDecideStock, FieldPolicyObserve, FieldPolicyReset, NULL},
+#ifndef STM32F4
+    {"entropy", "hit chance blended with expected information (host only)",
+     FieldPolicyPlaceRandom, FieldPolicyDecideEntropy, FieldPolicyObserve, FieldPolicyResetSampler,
+     NULL},
+#endif
+    {FIELD_POLICY_MODEL, "placement density weighted by a learned opponent prior",
+     FieldPolicyPlaceRandom, FieldPolicyDecideModel, FieldPolicyObserve, FieldPolicyReset,
+     FieldPolicyFinishModel},
+};
+
+#define FIELD_POLICY_NUM_BUILTINS (sizeof(fieldPolicyBuiltins) / sizeof(fieldPolicyBuiltins[0]))
+
+// Policies added by FieldPolicyRegister()
+static const FieldPolicy *fieldPolicyExtra[FIELD_POLICY_MAX - FIELD_POLICY_NUM_BUILTINS];
+static uint8_t fieldPolicyNumExtra = 0;
+
+
+/*  PROTOTYPES  */
+
+/** FieldPolicyStateInit(*state, *rng)
+ *
+ * @param   *state  The state.
+ * @param   *rng    The generator to seed from.
+ */
+void FieldPolicyStateInit(FieldPolicyState *state, Rng *rng)
+{
+    memset(state, 0, sizeof(*state));
+    RngSeed(&state->rng, RngNext(rng));
+    state->samples = FIELD_SAMPLER_DEFAULT_SAMPLES;
+    state->budgetMicros = FIELD_SAMPLER_DEFAULT_BUDGET_US;
+    state->deadlineMicros = FIELD_POLICY_DEFAULT_DEADLINE_US;
+}
+
+/** FieldPolicyFind(*name)
+ *
+ * @param   *name   A policy name.
+ * @return  The registered policy with that name, or NULL.
+ */
+const FieldPolicy *FieldPolicyFind(const char *name)
+{
+    for (uint8_t i = 0; i < FieldPolicyCount(); i++)
+    {
+        const FieldPolicy *policy = FieldPolicyGet(i);
+        if (strcmp(policy->name, name) == 0)
+        {
+            return policy;
+        }
+    }
+    return NULL;
+}
+
+/** FieldPolicyRegister(*policy)
+ *
+ * @param   *policy The policy, with every function but finish() set.
+ * @return  SUCCESS or STANDARD_ERROR.
+ */
+uint8_t FieldPolicyRegister(const FieldPolicy *policy)
+{
+    if (policy == NULL || policy->name == NULL || policy->place == NULL ||
+        policy->decide == NULL || policy->observe == NULL || policy->reset == NULL ||
+        FieldPolicyFind(policy->name) != NULL ||
+        fieldPolicyNumExtra >= FIELD_POLICY_MAX - FIELD_POLICY_NUM_BUILTINS)
+    {
+        return STANDARD_ERROR;
+    }
+    fieldPolicyExtra[fieldPolicyNumExtra++] = policy;
+    return SUCCESS;
+}
+
+/** FieldPolicyCount()
+ *
+ * @return  The number of registered policies.
+ */
+uint8_t FieldPolicyCount(void)
+{
+    return FIELD_POLICY_NUM_BUILTINS + fieldPolicyNumExtra;
+}
+
+/** FieldPolicyGet(index)
+ *
+ * @param   index   0 to FieldPolicyCount() - 1.
+ * @return  The policy, or NULL if index is out of range.
+ */
+const FieldPolicy *FieldPolicyGet(uint8_t index)
+{
+    if (index < FIELD_POLICY_NUM_BUILTINS)
+    {
+        return &fieldPolicyBuiltins[index];
+    }
+    index -= FIELD_POLICY_NUM_BUILTINS;
+    return (index < fieldPolicyNumExtra) ? fieldPolicyExtra[index] : NULL;
+}
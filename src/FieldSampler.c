@@ -0,0 +1,313 @@
+/**
+ * @file    FieldSampler.c
+ *
+ * Monte Carlo sampler over the opponent's field.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldPlacement.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// How many draws to make between clock reads
+#define FIELD_SAMPLER_CLOCK_STRIDE 64
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldSamplerNext(*rng)
+ *
+ * xorshift64*: small, fast on both targets, and good enough for sampling.
+ */
+static uint64_t FieldSamplerNext(uint64_t *rng)
+{
+    uint64_t x = *rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *rng = x;
+    return x * 0x2545F4914F6CDD1Dull;
+}
+
+/** FieldSamplerBelow(*rng, n)
+ *
+ * Returns a value in [0, n) without a division.
+ */
+static uint32_t FieldSamplerBelow(uint64_t *rng, uint32_t n)
+{
+    return (uint32_t)(((FieldSamplerNext(rng) >> 32) * n) >> 32);
+}
+
+/*  PROTOTYPES  */
+
+/** FieldSamplerMicros()
+ *
+ * @return  The current time in microseconds, from FieldAIMicros().
+ */
+uint32_t FieldSamplerMicros(void)
+{
+    return FieldAIMicros();
+}
+
+/** FieldSamplerPrepare(*oppField, *c)
+ *
+ * Builds the candidate placement lists for every boat.
+ *
+ * @param   *oppField   The opponent's field.
+ * @param   *c          Output candidate lists.
+ * @return  0 if some boat has no legal placement at all, 1 otherwise.
+ */
+uint8_t FieldSamplerPrepare(const Field *oppField, FieldSamplerCandidates *c)
+{
+    FieldBitboard misses = FieldGetBitboard(oppField, FIELD_SQUARE_MISS);
+    uint8_t alive = FieldGetBoatStates(oppField);
+
+    c->hits = FieldGetBitboard(oppField, FIELD_SQUARE_HIT);
+    c->unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        uint8_t isAlive = (alive >> type) & 1;
+        c->count[type] = 0;
+
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            FieldBitboard mask = fieldPlacements[p].mask;
+            if (FieldBitboardAnd(mask, misses))
+            {
+                continue;
+            }
+            // A sunk boat was hit everywhere; a live boat was not
+            uint8_t allHit = !FieldBitboardAndNot(mask, c->hits);
+            if (allHit == isAlive)
+            {
+                continue;
+            }
+            c->index[type][c->count[type]++] = p;
+        }
+        if (c->count[type] == 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** FieldSamplerDraw(*rng, *c)
+ *
+ * Draws each boat uniformly from its candidates, largest first so overlaps are
+ * found early.
+ *
+ * @param   *rng    xorshift64* state to draw from.
+ * @param   *c      Candidate lists from FieldSamplerPrepare().
+ * @return  The squares covered by the fleet, or 0 if the draw was rejected.
+ */
+FieldBitboard FieldSamplerDraw(uint64_t *rng, const FieldSamplerCandidates *c)
+{
+    return FieldSamplerDrawBoats(rng, c, NULL);
+}
+
+/** FieldSamplerDrawBoats(*rng, *c, placement)
+ *
+ * FieldSamplerDraw() that also reports where each boat went.
+ *
+ * @param   *rng        xorshift64* state to draw from.
+ * @param   *c          Candidate lists from FieldSamplerPrepare().
+ * @param   placement   If not NULL, receives an index into fieldPlacements per
+ *                      BoatType; only meaningful if the draw was accepted.
+ * @return  The squares covered by the fleet, or 0 if the draw was rejected.
+ */
+FieldBitboard FieldSamplerDrawBoats(uint64_t *rng, const FieldSamplerCandidates *c,
+                                    uint16_t placement[FIELD_NUM_BOATS])
+{
+    FieldBitboard occupied = 0;
+    for (int8_t type = FIELD_NUM_BOATS - 1; type >= 0; type--)
+    {
+        uint16_t p = c->index[type][FieldSamplerBelow(rng, c->count[type])];
+        FieldBitboard mask = fieldPlacements[p].mask;
+        if (FieldBitboardAnd(mask, occupied))
+        {
+            return 0;
+        }
+        occupied |= mask;
+        if (placement != NULL)
+        {
+            placement[type] = p;
+        }
+    }
+
+    // Every known hit must belong to some boat
+    if (FieldBitboardAndNot(c->hits, occupied))
+    {
+        return 0;
+    }
+    return occupied;
+}
+
+/** FieldSamplerSeed(seed, stream)
+ *
+ * Derives an independent xorshift64* state for one stream of a seed using
+ * splitmix64, so that nearby seeds and streams do not give correlated
+ * sequences.
+ *
+ * @param   seed    The base seed.
+ * @param   stream  The stream number, e.g. a worker index.
+ * @return  A nonzero RNG state.
+ */
+uint64_t FieldSamplerSeed(uint64_t seed, uint32_t stream)
+{
+    uint64_t z = seed + (stream + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    return z ? z : 0x9E3779B97F4A7C15ull;
+}
+
+/** FieldSamplerInit(*sampler, seed)
+ *
+ * Clears the tallies and seeds the sampler's random state.
+ *
+ * @param   *sampler    The sampler to initialize.
+ * @param   seed        Any value; 0 is replaced by a fixed nonzero constant.
+ */
+void FieldSamplerInit(FieldSampler *sampler, uint64_t seed)
+{
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        sampler->tally[i] = 0;
+    }
+    sampler->samples = 0;
+    sampler->attempts = 0;
+    sampler->rng = seed ? seed : 0x9E3779B97F4A7C15ull;
+}
+
+/** FieldSamplerRun(*sampler, *oppField, maxSamples, budgetMicros)
+ *
+ * Clears the tallies and samples configurations consistent with oppField
+ * until maxSamples have been accepted or budgetMicros have elapsed.
+ *
+ * @param   *sampler        The sampler to fill.
+ * @param   *oppField       The opponent's field.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldSamplerRun(FieldSampler *sampler, const Field *oppField,
+                         uint32_t maxSamples, uint32_t budgetMicros)
+{
+    FieldSamplerCandidates c;
+    uint32_t start = FieldSamplerMicros();
+
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++)
+    {
+        sampler->tally[i] = 0;
+    }
+    sampler->samples = 0;
+    sampler->attempts = 0;
+
+    if ((maxSamples == 0 && budgetMicros == 0) || !FieldSamplerPrepare(oppField, &c))
+    {
+        return 0;
+    }
+
+    uint32_t maxAttempts = UINT32_MAX;
+    if (maxSamples && maxSamples < UINT32_MAX / FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE)
+    {
+        maxAttempts = maxSamples * FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE;
+    }
+
+    while (sampler->attempts < maxAttempts)
+    {
+        if (maxSamples && sampler->samples >= maxSamples)
+        {
+            break;
+        }
+        if (budgetMicros && sampler->attempts % FIELD_SAMPLER_CLOCK_STRIDE == 0 &&
+            FieldSamplerMicros() - start >= budgetMicros)
+        {
+            break;
+        }
+
+        sampler->attempts++;
+        FieldBitboard occupied = FieldSamplerDraw(&sampler->rng, &c);
+        if (!occupied)
+        {
+            continue;
+        }
+
+        sampler->samples++;
+        FieldBitboard todo = FieldBitboardAnd(occupied, c.unknown);
+        while (todo)
+        {
+            sampler->tally[FieldBitboardPopFirst(&todo)]++;
+        }
+    }
+
+    return sampler->samples;
+}
+
+/** FieldSamplerBestGuess(*sampler, *oppField)
+ *
+ * Picks the unknown square that was covered in the most samples.
+ *
+ * @param   *sampler    A sampler filled by FieldSamplerRun().
+ * @param   *oppField   The same field that was sampled.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldSamplerBestGuess(const FieldSampler *sampler, const Field *oppField)
+{
+    FieldBitboard unknown = FieldGetBitboard(oppField, FIELD_SQUARE_UNKNOWN);
+    if (sampler->samples == 0 || !unknown)
+    {
+        return FieldDensityDecideGuess(oppField);
+    }
+
+    uint8_t best = FieldBitboardFirst(unknown);
+    FieldBitboard todo = unknown;
+    while (todo)
+    {
+        uint8_t i = FieldBitboardPopFirst(&todo);
+        if (sampler->tally[i] > sampler->tally[best])
+        {
+            best = i;
+        }
+    }
+
+    GuessData guess;
+    guess.row = FIELD_BITBOARD_ROW(best);
+    guess.col = FIELD_BITBOARD_COL(best);
+    guess.result = RESULT_MISS;
+    return guess;
+}
+
+/** FieldSamplerDecideGuess(*oppField)
+ *
+ * Runs a module-level sampler with the default limits and returns its best
+ * guess.
+ *
+ * @param   *oppField   The opponent's field.
+ * @return  A GuessData struct whose row and col parameters are the coordinates
+ *          of the guess.  The result parameter is irrelevant.
+ */
+GuessData FieldSamplerDecideGuess(const Field *oppField)
+{
+    static FieldSampler sampler;
+    static uint8_t seeded = 0;
+
+    if (!seeded)
+    {
+        FieldSamplerInit(&sampler, RngNext(RngDefault()));
+        seeded = 1;
+    }
+
+    FieldSamplerRun(&sampler, oppField,
+                    FIELD_SAMPLER_DEFAULT_SAMPLES, FIELD_SAMPLER_DEFAULT_BUDGET_US);
+    return FieldSamplerBestGuess(&sampler, oppField);
+}
@@ -0,0 +1,132 @@
+/**
+ * @file    FieldSamplerBench.c
+ *
+ * Measures the Monte Carlo sampler: accepted samples per second at each stage
+ * of a game, shots-to-win against the density engine, and how closely a
+ * microsecond budget is honored.
+ *
+ * @usage   `$ ./FieldSampler_bench [games] [samples] [budget_us] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+#define DEFAULT_GAMES 50
+#define DEFAULT_SAMPLES 20000
+#define DEFAULT_BUDGET_US 8000
+
+// Game stages are reported in bins of this many shots
+#define STAGE_SHOTS 20
+#define NUM_STAGES (FIELD_NUM_SQUARES / STAGE_SHOTS + 1)
+
+typedef struct {
+    uint64_t decisions;
+    uint64_t samples;
+    uint64_t attempts;
+    uint64_t micros;
+} StageStats;
+
+/**
+ * Plays one game with the given decision rule and returns the number of shots.
+ * When `sampler` is non-NULL the sampler is used and its per-stage throughput
+ * recorded; otherwise the density engine shoots.
+ */
+static uint16_t PlayGame(const Field *layout, FieldSampler *sampler, uint32_t samples,
+                         uint32_t budget, StageStats stages[NUM_STAGES], uint32_t *worstMicros)
+{
+    Field target = *layout;
+    Field knowledge;
+    FieldInit(NULL, &knowledge);
+
+    uint16_t shots = 0;
+    while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+    {
+        GuessData guess;
+        if (sampler)
+        {
+            uint32_t start = FieldSamplerMicros();
+            FieldSamplerRun(sampler, &knowledge, samples, budget);
+            uint32_t elapsed = FieldSamplerMicros() - start;
+            guess = FieldSamplerBestGuess(sampler, &knowledge);
+
+            StageStats *stage = &stages[shots / STAGE_SHOTS];
+            stage->decisions++;
+            stage->samples += sampler->samples;
+            stage->attempts += sampler->attempts;
+            stage->micros += elapsed;
+            if (elapsed > *worstMicros)
+            {
+                *worstMicros = elapsed;
+            }
+        }
+        else
+        {
+            guess = FieldDensityDecideGuess(&knowledge);
+        }
+        FieldRegisterEnemyAttack(&target, &guess);
+        FieldUpdateKnowledge(&knowledge, &guess);
+        shots++;
+    }
+    return shots;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t games = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_GAMES;
+    uint32_t samples = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : DEFAULT_SAMPLES;
+    uint32_t budget = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 10) : DEFAULT_BUDGET_US;
+    unsigned seed = (argc > 4) ? (unsigned)strtoul(argv[4], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    FieldSampler sampler;
+    FieldSamplerInit(&sampler, seed);
+    StageStats counted[NUM_STAGES] = {{0}};
+    StageStats timed[NUM_STAGES] = {{0}};
+    uint32_t worstCounted = 0;
+    uint32_t worstTimed = 0;
+    uint64_t densityShots = 0, countedShots = 0, timedShots = 0;
+
+    for (uint32_t g = 0; g < games; g++)
+    {
+        Field layout;
+        FieldInit(&layout, NULL);
+        FieldAIPlaceAllBoats(&layout);
+        densityShots += PlayGame(&layout, NULL, 0, 0, NULL, NULL);
+        countedShots += PlayGame(&layout, &sampler, samples, 0, counted, &worstCounted);
+        timedShots += PlayGame(&layout, &sampler, 0, budget, timed, &worstTimed);
+    }
+
+    printf("=== FieldSampler benchmark: %u games, seed %u ===\n", games, seed);
+    printf("avg shots: density %.2f, sampler(%u samples) %.2f, sampler(%u us) %.2f\n",
+           (double)densityShots / games, samples, (double)countedShots / games,
+           budget, (double)timedShots / games);
+
+    printf("\n%-8s %14s %12s %14s %12s\n",
+           "shots", "samples/s", "accept %", "samp/decision", "accept %");
+    for (int s = 0; s < NUM_STAGES; s++)
+    {
+        if (!counted[s].micros || !timed[s].attempts)
+        {
+            continue;
+        }
+        printf("%2d-%-5d %14.0f %11.1f%% %14.0f %11.1f%%\n",
+               s * STAGE_SHOTS, s * STAGE_SHOTS + STAGE_SHOTS - 1,
+               counted[s].samples * 1e6 / counted[s].micros,
+               100.0 * counted[s].samples / counted[s].attempts,
+               (double)timed[s].samples / timed[s].decisions,
+               100.0 * timed[s].samples / timed[s].attempts);
+    }
+
+    printf("\nworst decision: %u us with %u samples, %u us with a %u us budget\n",
+           worstCounted, samples, worstTimed, budget);
+
+    return 0;
+}
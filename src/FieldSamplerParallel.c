@@ -0,0 +1,280 @@
+/**
+ * @file    FieldSamplerParallel.c
+ *
+ * Host-only multi-threaded backend for the Monte Carlo sampler.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "Field.h"
+#include "FieldSampler.h"
+#include "FieldSamplerParallel.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// How many draws to make between clock reads
+#define FIELD_SAMPLER_CLOCK_STRIDE 64
+
+// Packs a [next, end) range of chunk indices into one atomic word
+#define RANGE(next, end) (((uint64_t)(next) << 32) | (uint32_t)(end))
+#define RANGE_NEXT(range) ((uint32_t)((range) >> 32))
+#define RANGE_END(range) ((uint32_t)(range))
+
+struct FieldSamplerJob;
+
+/**
+ * Per-thread state. Each worker is cache-line aligned so that one thread's
+ * tallies never share a line with another's.
+ */
+typedef struct {
+    _Alignas(64) _Atomic uint64_t range;    // Chunks this worker still owns
+    FieldSampler local;                     // Private tallies and RNG
+    struct FieldSamplerJob *job;
+    uint16_t id;
+} FieldSamplerWorker;
+
+/**
+ * State shared read-only by all workers, plus the stop flag.
+ */
+typedef struct FieldSamplerJob {
+    const FieldSamplerCandidates *candidates;
+    FieldSamplerWorker *workers;
+    uint16_t threads;
+    uint32_t maxSamples;        // 0 when running on the budget alone
+    uint32_t budgetMicros;
+    uint32_t start;
+    atomic_bool stop;           // Set once the budget runs out
+} FieldSamplerJob;
+
+/*  PRIVATE FUNCTIONS   */
+
+/** FieldSamplerClaim(*worker, *chunk)
+ *
+ * Takes the next chunk from the front of the worker's own range.
+ */
+static uint8_t FieldSamplerClaim(FieldSamplerWorker *worker, uint32_t *chunk)
+{
+    uint64_t range = atomic_load(&worker->range);
+    while (RANGE_NEXT(range) < RANGE_END(range))
+    {
+        uint64_t claimed = RANGE(RANGE_NEXT(range) + 1, RANGE_END(range));
+        if (atomic_compare_exchange_weak(&worker->range, &range, claimed))
+        {
+            *chunk = RANGE_NEXT(range);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/** FieldSamplerSteal(*thief)
+ *
+ * Moves half of the remaining chunks from the back of another worker's range
+ * into the thief's (empty) range. Victims are tried in round-robin order
+ * starting after the thief.
+ */
+static uint8_t FieldSamplerSteal(FieldSamplerWorker *thief)
+{
+    FieldSamplerJob *job = thief->job;
+
+    for (uint16_t k = 1; k < job->threads; k++)
+    {
+        FieldSamplerWorker *victim = &job->workers[(thief->id + k) % job->threads];
+        uint64_t range = atomic_load(&victim->range);
+
+        while (RANGE_NEXT(range) < RANGE_END(range))
+        {
+            uint32_t remaining = RANGE_END(range) - RANGE_NEXT(range);
+            uint32_t split = RANGE_END(range) - (remaining + 1) / 2;
+            if (atomic_compare_exchange_weak(&victim->range, &range,
+                                             RANGE(RANGE_NEXT(range), split)))
+            {
+                atomic_store(&thief->range, RANGE(split, RANGE_END(range)));
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/** FieldSamplerSample(*worker, wanted)
+ *
+ * Draws until `wanted` samples are accepted (0 = until stopped), the attempt
+ * cap is reached, or the budget runs out.
+ */
+static void FieldSamplerSample(FieldSamplerWorker *worker, uint32_t wanted)
+{
+    FieldSamplerJob *job = worker->job;
+    FieldSampler *local = &worker->local;
+    const FieldSamplerCandidates *c = job->candidates;
+    uint32_t accepted = 0;
+    uint32_t attempts = 0;
+    uint32_t maxAttempts = wanted ? wanted * FIELD_SAMPLER_ATTEMPTS_PER_SAMPLE : UINT32_MAX;
+
+    while (attempts < maxAttempts && (wanted == 0 || accepted < wanted))
+    {
+        if (job->budgetMicros && attempts % FIELD_SAMPLER_CLOCK_STRIDE == 0)
+        {
+            if (atomic_load_explicit(&job->stop, memory_order_relaxed) ||
+                FieldSamplerMicros() - job->start >= job->budgetMicros)
+            {
+                atomic_store_explicit(&job->stop, 1, memory_order_relaxed);
+                break;
+            }
+        }
+
+        attempts++;
+        FieldBitboard occupied = FieldSamplerDraw(&local->rng, c);
+        if (!occupied)
+        {
+            continue;
+        }
+
+        accepted++;
+        FieldBitboard todo = FieldBitboardAnd(occupied, c->unknown);
+        while (todo)
+        {
+            local->tally[FieldBitboardPopFirst(&todo)]++;
+        }
+    }
+
+    local->samples += accepted;
+    local->attempts += attempts;
+}
+
+/** FieldSamplerWork(*arg)
+ *
+ * Thread body: work through our own chunks, then steal until nothing is left.
+ */
+static void *FieldSamplerWork(void *arg)
+{
+    FieldSamplerWorker *worker = arg;
+    FieldSamplerJob *job = worker->job;
+
+    if (job->maxSamples == 0)
+    {
+        FieldSamplerSample(worker, 0);
+        return NULL;
+    }
+
+    uint32_t chunk;
+    while (!atomic_load_explicit(&job->stop, memory_order_relaxed))
+    {
+        if (!FieldSamplerClaim(worker, &chunk))
+        {
+            if (!FieldSamplerSteal(worker))
+            {
+                break;
+            }
+            continue;
+        }
+
+        // The last chunk may be short
+        uint32_t wanted = job->maxSamples - chunk * FIELD_SAMPLER_CHUNK;
+        FieldSamplerSample(worker, wanted < FIELD_SAMPLER_CHUNK ? wanted : FIELD_SAMPLER_CHUNK);
+    }
+    return NULL;
+}
+
+/*  PROTOTYPES  */
+
+/** FieldSamplerRunParallel(*sampler, *oppField, maxSamples, budgetMicros, threads)
+ *
+ * Parallel version of FieldSamplerRun().
+ *
+ * @param   *sampler        Receives the merged results.
+ * @param   *oppField       The opponent's field.
+ * @param   maxSamples      Accepted samples to collect, or 0.
+ * @param   budgetMicros    Time limit in microseconds, or 0.
+ * @param   threads         Worker threads to use.
+ * @return  The number of accepted samples.
+ */
+uint32_t FieldSamplerRunParallel(FieldSampler *sampler, const Field *oppField,
+                                 uint32_t maxSamples, uint32_t budgetMicros,
+                                 uint16_t threads)
+{
+    FieldSamplerCandidates candidates;
+    FieldSamplerJob job;
+    uint64_t seed = sampler->rng;
+
+    FieldSamplerInit(sampler, seed);
+    sampler->rng = FieldSamplerSeed(seed, FIELD_SAMPLER_MAX_THREADS);
+
+    if ((maxSamples == 0 && budgetMicros == 0) || !FieldSamplerPrepare(oppField, &candidates))
+    {
+        return 0;
+    }
+    if (threads < 1)
+    {
+        threads = 1;
+    }
+    if (threads > FIELD_SAMPLER_MAX_THREADS)
+    {
+        threads = FIELD_SAMPLER_MAX_THREADS;
+    }
+
+    FieldSamplerWorker *workers = aligned_alloc(64, sizeof(FieldSamplerWorker) * threads);
+    pthread_t *handles = malloc(sizeof(pthread_t) * threads);
+    if (workers == NULL || handles == NULL)
+    {
+        free(workers);
+        free(handles);
+        return FieldSamplerRun(sampler, oppField, maxSamples, budgetMicros);
+    }
+
+    job.candidates = &candidates;
+    job.workers = workers;
+    job.threads = threads;
+    job.maxSamples = maxSamples;
+    job.budgetMicros = budgetMicros;
+    job.start = FieldSamplerMicros();
+    atomic_init(&job.stop, 0);
+
+    // Deal the chunks out evenly; stealing fixes any imbalance later
+    uint32_t chunks = (maxSamples + FIELD_SAMPLER_CHUNK - 1) / FIELD_SAMPLER_CHUNK;
+    for (uint16_t i = 0; i < threads; i++)
+    {
+        uint32_t first = (uint32_t)((uint64_t)chunks * i / threads);
+        uint32_t end = (uint32_t)((uint64_t)chunks * (i + 1) / threads);
+        atomic_init(&workers[i].range, RANGE(first, end));
+        FieldSamplerInit(&workers[i].local, FieldSamplerSeed(seed, i));
+        workers[i].job = &job;
+        workers[i].id = i;
+    }
+
+    // The calling thread works as worker 0
+    uint16_t started = 1;
+    for (uint16_t i = 1; i < threads; i++)
+    {
+        if (pthread_create(&handles[i], NULL, FieldSamplerWork, &workers[i]) != 0)
+        {
+            break;
+        }
+        started++;
+    }
+    FieldSamplerWork(&workers[0]);
+    for (uint16_t i = 1; i < started; i++)
+    {
+        pthread_join(handles[i], NULL);
+    }
+    // Workers that failed to start leave their chunks behind; worker 0 has
+    // already stolen them, since it only stops once every range is empty.
+
+    for (uint16_t i = 0; i < threads; i++)
+    {
+        for (uint8_t s = 0; s < FIELD_NUM_SQUARES; s++)
+        {
+            sampler->tally[s] += workers[i].local.tally[s];
+        }
+        sampler->samples += workers[i].local.samples;
+        sampler->attempts += workers[i].local.attempts;
+    }
+
+    free(workers);
+    free(handles);
+    return sampler->samples;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file    FieldSamplerParallelBench.c
+ *
+ * Scaling benchmark for the parallel sampler. Runs FieldSamplerRunParallel()
+ * on an early, middle and late game state with 1, 2, 4, ... up to N threads
+ * and reports accepted samples per second and speedup over one thread.
+ *
+ * @usage   `$ ./FieldSamplerParallel_bench [max_threads] [samples] [seed]`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldSampler.h"
+#include "FieldSamplerParallel.h"
+#include "Rng.h"
+
+#define DEFAULT_SAMPLES 1000000
+
+// Board states are taken after this many density-engine shots
+static const uint8_t stageShots[] = {0, 15, 30};
+#define NUM_STAGES (sizeof(stageShots) / sizeof(stageShots[0]))
+
+/**
+ * Times one run with the given number of threads and prints its row. *base is
+ * the one-thread rate, set when threads is 1.
+ */
+static void BenchRow(FieldSampler *sampler, uint8_t stage, const Field *oppField,
+                     uint32_t samples, uint16_t threads, double *base)
+{
+    uint32_t start = FieldSamplerMicros();
+    uint32_t accepted = FieldSamplerRunParallel(sampler, oppField, samples, 0, threads);
+    uint32_t elapsed = FieldSamplerMicros() - start;
+    double rate = accepted * 1e6 / (elapsed ? elapsed : 1);
+    if (threads == 1)
+    {
+        *base = rate;
+    }
+    printf("%-7u %8u %14.0f %9.2fx %9.2f%%\n", stageShots[stage], threads, rate,
+           *base ? rate / *base : 0.0,
+           sampler->attempts ? 100.0 * sampler->samples / sampler->attempts : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    uint16_t maxThreads = (argc > 1) ? (uint16_t)strtoul(argv[1], NULL, 10) :
+                          (uint16_t)(online > 0 ? online : 1);
+    if (maxThreads < 1)
+    {
+        maxThreads = 1;
+    }
+    uint32_t samples = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : DEFAULT_SAMPLES;
+    unsigned seed = (argc > 3) ? (unsigned)strtoul(argv[3], NULL, 10) : 1;
+    RngSeed(RngDefault(), seed);
+
+    // Build the board states by letting the density engine play one game
+    Field layout;
+    Field stages[NUM_STAGES];
+    Field knowledge;
+    FieldInit(&layout, &knowledge);
+    FieldAIPlaceAllBoats(&layout);
+    uint8_t shots = 0;
+    for (uint8_t s = 0; s < NUM_STAGES; s++)
+    {
+        while (shots < stageShots[s] && FieldGetBoatStates(&layout))
+        {
+            GuessData guess = FieldDensityDecideGuess(&knowledge);
+            FieldRegisterEnemyAttack(&layout, &guess);
+            FieldUpdateKnowledge(&knowledge, &guess);
+            shots++;
+        }
+        stages[s] = knowledge;
+    }
+
+    printf("=== FieldSampler parallel benchmark: %u samples, up to %u threads ===\n",
+           samples, maxThreads);
+    printf("%-7s %8s %14s %10s %10s\n", "shots", "threads", "samples/s", "speedup", "accept %");
+
+    FieldSampler sampler;
+    FieldSamplerInit(&sampler, seed);
+    for (uint8_t s = 0; s < NUM_STAGES; s++)
+    {
+        double base = 0;
+        // Powers of two below maxThreads, then exactly maxThreads
+        for (uint16_t threads = 1; threads < maxThreads; threads *= 2)
+        {
+            BenchRow(&sampler, s, &stages[s], samples, threads, &base);
+        }
+        BenchRow(&sampler, s, &stages[s], samples, maxThreads, &base);
+    }
+
+    return 0;
+}
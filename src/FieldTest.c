@@ -11,10 +11,17 @@
 #include <stdlib.h>     // For standard library functions
 #include <assert.h>     // For assert macro (not used in this file)
 #include <stdio.h>      // For printf
+#include <stddef.h>     // For offsetof
 #include <stdbool.h>    // For boolean types (true/false)
+#include <string.h>     // For memcmp
 
 // Project headers
 #include "Field.h"      // Declares Field structure and game-related functions
+#include "FieldAttribution.h" // Works out which hits belong to sunk boats
+#include "FieldBoard.h"   // Runtime board sizes and fleets
+#include "FieldLayout.h"  // Tuned fleet layouts
+#include "FieldPacked.h"  // Nibble-packed field storage
+#include "FieldPlacement.h" // Placement tables and hunt lattices
 #include "BOARD.h"      // Project-specific initialization and support
 #include "BattleBoats.h"// Defines constants like boat sizes and statuses
 
@@ -281,6 +288,62 @@ void Check(bool condition, const char* testName) {
     }
 }
 
+// ------------------------- FIELD BOAT TABLE TEST ---------------------------
+
+/**
+ * Tests that boats of one type sink one at a time, each with its own last
+ * square, and that the boat table is bounded.
+ */
+void TestFieldBoatTable() {
+    Field own;
+    FieldInit(&own, NULL);
+    Check(FieldAddBoat(&own, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL) == SUCCESS &&
+        FieldAddBoat(&own, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL) == SUCCESS,
+        "FieldBoatTable two small boats added");
+    Check(own.numBoats == 2 && FieldGetBoatId(&own, 0, 2) == 0 &&
+        FieldGetBoatId(&own, 2, 1) == 1 && FieldGetBoatId(&own, 1, 0) == FIELD_NO_BOAT &&
+        FieldGetBoatId(&own, FIELD_ROWS, 0) == FIELD_NO_BOAT,
+        "FieldBoatTable squares numbered by boat");
+
+    GuessData guess = {0, 0, RESULT_MISS};
+    uint8_t sunk = 1;
+    for (uint8_t col = 0; col < FIELD_BOAT_SIZE_SMALL; col++) {
+        guess.row = 2;
+        guess.col = col;
+        FieldRegisterEnemyAttack(&own, &guess);
+        sunk = sunk && (guess.result == ((col == FIELD_BOAT_SIZE_SMALL - 1) ?
+            RESULT_SMALL_BOAT_SUNK : RESULT_HIT));
+    }
+    Check(sunk && own.boatLives[1] == 0 && own.boatLives[0] == FIELD_BOAT_SIZE_SMALL,
+        "FieldBoatTable second small boat sinks alone");
+    Check(FieldGetBoatStates(&own) & FIELD_BOAT_STATUS_SMALL,
+        "FieldBoatTable small type afloat while one boat is");
+
+    guess.row = 0;
+    for (uint8_t col = 0; col < FIELD_BOAT_SIZE_SMALL; col++) {
+        guess.col = col;
+        FieldRegisterEnemyAttack(&own, &guess);
+    }
+    Check(guess.result == RESULT_SMALL_BOAT_SUNK &&
+        !(FieldGetBoatStates(&own) & FIELD_BOAT_STATUS_SMALL),
+        "FieldBoatTable first small boat sinks the type");
+
+    // A field full of small boats fills the table
+    FieldInit(&own, NULL);
+    uint8_t added = 0;
+    for (uint8_t row = 0; row < FIELD_ROWS; row++) {
+        for (uint8_t col = 0; col + FIELD_BOAT_SIZE_SMALL <= FIELD_COLS; col += FIELD_BOAT_SIZE_SMALL) {
+            added += FieldAddBoat(&own, row, col, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL) == SUCCESS;
+        }
+    }
+    Check(added == FIELD_ROWS * (FIELD_COLS / FIELD_BOAT_SIZE_SMALL) &&
+        own.numBoats == added && FieldGetBoatId(&own, FIELD_ROWS - 1, 8) == added - 1,
+        "FieldBoatTable numbers a field full of boats");
+    own.numBoats = FIELD_MAX_BOATS;
+    Check(FieldAddBoat(&own, 0, 9, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_SMALL) == STANDARD_ERROR,
+        "FieldBoatTable refuses a boat past FIELD_MAX_BOATS");
+}
+
 // -------------------- FIELD UPDATE KNOWLEDGE TEST ---------------------------
 
 /**
@@ -316,6 +379,175 @@ void TestFieldGetBoatStates() {
     Check(status == expected, "FieldGetBoatStates status check");
 }
 
+// ------------------------- FIELD BITBOARD TEST -----------------------------
+
+/**
+ * Tests that the bit planes track the grid through every Field mutator.
+ */
+void TestFieldBitboards() {
+    Field own;
+    Field opp;
+    FieldInit(&own, &opp);
+
+    Check(FieldGetBitboard(&own, FIELD_SQUARE_EMPTY) == FIELD_BITBOARD_ALL,
+        "FieldBitboards own field starts all empty");
+    Check(FieldBitboardCount(FieldGetBitboard(&opp, FIELD_SQUARE_UNKNOWN)) == FIELD_NUM_SQUARES,
+        "FieldBitboards opponent field starts all unknown");
+
+    // Small boat EAST at (0,0) covers bits 0..2
+    FieldAddBoat(&own, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL);
+    FieldBitboard small = FieldGetBitboard(&own, FIELD_SQUARE_SMALL_BOAT);
+    Check(small == 0x7, "FieldBitboards small boat plane after FieldAddBoat");
+    Check(FieldBitboardAnd(small, FieldGetBitboard(&own, FIELD_SQUARE_EMPTY)) == 0,
+        "FieldBitboards boat squares removed from empty plane");
+
+    // Overlapping placement must be rejected without touching the planes
+    uint8_t result = FieldAddBoat(&own, 0, 1, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM);
+    Check(result == STANDARD_ERROR && FieldGetBitboard(&own, FIELD_SQUARE_MEDIUM_BOAT) == 0,
+        "FieldBitboards overlap rejected");
+
+    GuessData guess = { 0, 1, RESULT_MISS };
+    FieldRegisterEnemyAttack(&own, &guess);
+    Check(FieldGetBitboard(&own, FIELD_SQUARE_HIT) == FIELD_BITBOARD_SQUARE(0, 1) &&
+        FieldGetBitboard(&own, FIELD_SQUARE_SMALL_BOAT) == 0x5,
+        "FieldBitboards enemy hit moves square to hit plane");
+
+    guess.row = 3;
+    guess.col = 4;
+    guess.result = RESULT_MISS;
+    FieldUpdateKnowledge(&opp, &guess);
+    FieldBitboard unknown = FieldGetBitboard(&opp, FIELD_SQUARE_UNKNOWN);
+    Check(FieldBitboardAndNot(FIELD_BITBOARD_ALL, unknown) == FIELD_BITBOARD_SQUARE(3, 4),
+        "FieldBitboards miss removed from unknown plane");
+    Check(FieldBitboardFirst(FieldGetBitboard(&opp, FIELD_SQUARE_MISS)) ==
+        FIELD_BITBOARD_INDEX(3, 4), "FieldBitboards first set bit");
+
+    FieldSetSquareStatus(&opp, 0, 0, FIELD_SQUARE_CURSOR);
+    Check(FieldBitboardCount(FieldGetBitboard(&opp, FIELD_SQUARE_UNKNOWN)) == FIELD_NUM_SQUARES - 2,
+        "FieldBitboards cursor square leaves all planes");
+
+    // Iterating the hit plane should visit exactly one square
+    FieldBitboard todo = FieldGetBitboard(&own, FIELD_SQUARE_HIT);
+    uint8_t visited = 0;
+    while (todo) {
+        uint8_t i = FieldBitboardPopFirst(&todo);
+        visited += (FIELD_BITBOARD_ROW(i) == 0 && FIELD_BITBOARD_COL(i) == 1);
+    }
+    Check(visited == 1, "FieldBitboards pop-first iteration");
+
+    // Direct grid writes are picked up by FieldSyncBitboards()
+    opp.grid[5][9] = FIELD_SQUARE_HIT;
+    FieldSyncBitboards(&opp);
+    Check(FieldGetBitboard(&opp, FIELD_SQUARE_HIT) == FIELD_BITBOARD_SQUARE(5, 9),
+        "FieldBitboards sync after direct grid write");
+}
+
+// ---------------------------- FIELD HASH TEST -------------------------------
+
+/**
+ * Tests that the Zobrist hash names a state whatever order it was reached in,
+ * and that the incremental updates agree with a full recomputation.
+ */
+void TestFieldHash() {
+    Field a, b, own;
+    GuessData shots[4] = {
+        {1, 1, RESULT_MISS}, {2, 2, RESULT_HIT}, {2, 3, RESULT_HIT}, {2, 4, RESULT_SMALL_BOAT_SUNK}
+    };
+
+    FieldInit(&own, &a);
+    FieldInit(NULL, &b);
+    Check(FieldGetHash(&a) == FieldGetHash(&b) && FieldGetHash(&a) != FieldGetHash(&own),
+        "FieldHash fresh fields");
+
+    // The same shots in opposite orders
+    for (uint8_t i = 0; i < 4; i++) {
+        FieldUpdateKnowledge(&a, &shots[i]);
+        FieldUpdateKnowledge(&b, &shots[3 - i]);
+    }
+    Check(FieldGetHash(&a) == FieldGetHash(&b), "FieldHash independent of shot order");
+
+    uint64_t before = FieldGetHash(&a);
+    FieldSyncBitboards(&a);
+    Check(FieldGetHash(&a) == before, "FieldHash opponent field matches recomputation");
+
+    // The sunk boat is part of the state
+    b.smallBoatLives = FIELD_BOAT_SIZE_SMALL;
+    FieldSyncBitboards(&b);
+    Check(FieldGetHash(&b) != before, "FieldHash tells sunk boats apart");
+
+    FieldAddBoat(&own, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL);
+    FieldAddBoat(&own, 3, 0, FIELD_DIR_SOUTH, FIELD_BOAT_TYPE_MEDIUM);
+    for (uint8_t col = 0; col < 4; col++) {
+        GuessData guess = {0, col, RESULT_MISS};
+        FieldRegisterEnemyAttack(&own, &guess);
+    }
+    before = FieldGetHash(&own);
+    FieldSyncBitboards(&own);
+    Check(FieldGetHash(&own) == before, "FieldHash own field matches recomputation");
+}
+
+// --------------------------- FIELD PACKED TEST ------------------------------
+
+#ifndef STM32F4
+/**
+ * Tests that FieldPacked holds the same board as a Field and answers the same
+ * queries.
+ */
+void TestFieldPacked() {
+    Field own, back;
+    FieldPacked packed;
+
+    FieldInit(&own, NULL);
+    FieldAIPlaceAllBoats(&own);
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i += 3) {
+        GuessData guess = {FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i), RESULT_MISS};
+        FieldRegisterEnemyAttack(&own, &guess);
+    }
+
+    Check(FieldPack(&packed, &own) == SUCCESS && sizeof(packed) == 32, "FieldPack");
+
+    bool same = FieldPackedGetBoatStates(&packed) == FieldGetBoatStates(&own);
+    for (uint8_t p = 0; p < FIELD_NUM_PLANES; p++) {
+        same = same && FieldPackedGetBitboard(&packed, p) == FieldGetBitboard(&own, p);
+    }
+    Check(same, "FieldPackedGetBitboard and FieldPackedGetBoatStates");
+
+    FieldUnpack(&back, &packed);
+    // Everything but the boat table, which is not packed
+    Check(memcmp(&back, &own, offsetof(Field, boatId)) == 0 && back.numBoats == 0,
+        "FieldUnpack restores the field");
+
+    Check(FieldPackedSetSquareStatus(&packed, 5, 9, FIELD_SQUARE_CURSOR) ==
+        FieldGetSquareStatus(&own, 5, 9) &&
+        FieldPackedGetSquareStatus(&packed, 5, 9) == FIELD_SQUARE_CURSOR &&
+        FieldPackedGetBitboard(&packed, FIELD_SQUARE_CURSOR) == FIELD_BITBOARD_SQUARE(5, 9) &&
+        FieldPackedGetSquareStatus(&packed, FIELD_ROWS, 0) == FIELD_SQUARE_INVALID &&
+        FieldPackedGetBoatStates(&packed) == FieldGetBoatStates(&own),
+        "FieldPackedSetSquareStatus");
+
+    // Shot for shot, the unpacked field sinks boats like the original
+    same = true;
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++) {
+        GuessData a = {FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i), RESULT_MISS}, b = a;
+        FieldRegisterEnemyAttack(&own, &a);
+        FieldRegisterEnemyAttack(&back, &b);
+        same = same && a.result == b.result;
+    }
+    Check(same && FieldGetBoatStates(&back) == 0 && FieldGetBoatStates(&own) == 0,
+        "FieldUnpack sinks boats like the original");
+
+    Field twin;
+    FieldInit(&twin, NULL);
+    Check(FieldAddBoat(&twin, 0, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL) == SUCCESS &&
+        FieldAddBoat(&twin, 2, 0, FIELD_DIR_EAST, FIELD_BOAT_TYPE_SMALL) == SUCCESS &&
+        FieldPack(&packed, &twin) == STANDARD_ERROR,
+        "FieldPack refuses two boats of one type");
+
+    own.hugeBoatLives = FIELD_PACKED_MAX_LIVES + 1;
+    Check(FieldPack(&packed, &own) == STANDARD_ERROR, "FieldPack refuses lives it cannot hold");
+}
+#endif
+
 // ---------------------- FIELD AI PLACE BOATS TEST ---------------------------
 
 /**
@@ -333,6 +565,49 @@ void TestFieldAIPlaceAllBoats() {
     Check(field.mediumBoatLives == FIELD_BOAT_SIZE_MEDIUM, "FieldAIPlaceAllBoats medium boat lives check");
     Check(field.largeBoatLives == FIELD_BOAT_SIZE_LARGE, "FieldAIPlaceAllBoats large boat lives check");
     Check(field.hugeBoatLives == FIELD_BOAT_SIZE_HUGE, "FieldAIPlaceAllBoats huge boat lives check");
+
+    // The uniform mode places the same fleet
+    FieldInit(&field, NULL);
+    result = FieldAIPlaceAllBoatsUniform(&field);
+    int boatSquares = 0;
+    for (int r = 0; r < FIELD_ROWS; r++) {
+        for (int c = 0; c < FIELD_COLS; c++) {
+            boatSquares += (field.grid[r][c] != FIELD_SQUARE_EMPTY);
+        }
+    }
+    Check(result == SUCCESS && boatSquares == FIELD_BOAT_SIZE_SMALL + FIELD_BOAT_SIZE_MEDIUM +
+          FIELD_BOAT_SIZE_LARGE + FIELD_BOAT_SIZE_HUGE && field.hugeBoatLives == FIELD_BOAT_SIZE_HUGE,
+          "FieldAIPlaceAllBoatsUniform places every boat");
+
+    // A field with no room fails instead of retrying forever
+    FieldInit(&field, NULL);
+    for (int r = 0; r < FIELD_ROWS; r++) {
+        for (int c = (r % 2); c < FIELD_COLS; c += 2) {
+            FieldSetSquareStatus(&field, r, c, FIELD_SQUARE_MISS);
+        }
+    }
+    Field blocked = field;
+    Check(FieldAIPlaceAllBoats(&field) == STANDARD_ERROR, "FieldAIPlaceAllBoats no room check");
+    Check(FieldAIPlaceAllBoatsUniform(&blocked) == STANDARD_ERROR &&
+          blocked.grid[0][1] == FIELD_SQUARE_EMPTY,
+          "FieldAIPlaceAllBoatsUniform no room check");
+
+    // Every tuned layout is a legal fleet and the weights add up
+    uint16_t weights = 0;
+    uint16_t legal = 0;
+    for (int i = 0; i < FIELD_NUM_LAYOUTS; i++) {
+        FieldInit(&field, NULL);
+        legal += (FieldLayoutPlace(&fieldLayouts[i], &field) == SUCCESS &&
+                  FieldGetBoatStates(&field) == (FIELD_BOAT_STATUS_SMALL | FIELD_BOAT_STATUS_MEDIUM |
+                                                 FIELD_BOAT_STATUS_LARGE | FIELD_BOAT_STATUS_HUGE));
+        weights += fieldLayouts[i].weight;
+    }
+    Check(legal == FIELD_NUM_LAYOUTS && weights == fieldLayoutWeightTotal,
+          "FieldLayout table check");
+
+    FieldInit(&field, NULL);
+    Check(FieldAIPlaceAllBoatsTuned(&field) == SUCCESS && field.hugeBoatLives == FIELD_BOAT_SIZE_HUGE,
+          "FieldAIPlaceAllBoatsTuned places every boat");
 }
 
 // ----------------------- FIELD AI GUESS TEST --------------------------------
@@ -358,6 +633,235 @@ void TestFieldAIDecideGuess() {
     Check(isUnknown, "FieldAIDecideGuess guess is unknown square");
 }
 
+/**
+ * Tests that every boat crosses the hunt lattices meant for it, and that the
+ * hunt follows the shortest boat still afloat.
+ */
+void TestFieldAIHunt() {
+    bool crosses = true;
+    for (uint8_t t = 0; t < FIELD_NUM_BOATS; t++) {
+        for (uint8_t offset = 0; offset < fieldBoatSizes[t]; offset++) {
+            for (uint16_t p = fieldPlacementFirst[t]; p < FIELD_NUM_PLACEMENTS; p++) {
+                crosses = crosses && (fieldPlacements[p].mask & fieldHuntLattices[t][offset]);
+            }
+        }
+    }
+    Check(crosses, "FieldAIHunt every longer boat crosses every lattice");
+
+    Field opp;
+    FieldAIState state;
+    FieldInit(NULL, &opp);
+    FieldAIStateInit(&state);
+    GuessData guess = FieldAIStateDecideGuess(&state, &opp);
+    Check((guess.row + guess.col) % FIELD_BOAT_SIZE_SMALL == 0,
+        "FieldAIHunt spaced by the small boat");
+
+    // With the small boat gone, the medium lattice through the sunk square,
+    // which has one unknown square fewer than the others
+    GuessData sunk = {5, 9, RESULT_SMALL_BOAT_SUNK};
+    FieldUpdateKnowledge(&opp, &sunk);
+    FieldAIStateUpdate(&state, &sunk);
+    state.attributeSunk = 0;
+    guess = FieldAIStateDecideGuess(&state, &opp);
+    Check((guess.row + guess.col) % FIELD_BOAT_SIZE_MEDIUM == 2 &&
+        FieldGetSquareStatus(&opp, guess.row, guess.col) == FIELD_SQUARE_UNKNOWN,
+        "FieldAIHunt spaced by the medium boat once the small one sinks");
+
+    // Misses along another offset make it the cheapest to finish
+    for (uint8_t i = 0; i < FIELD_NUM_SQUARES; i++) {
+        if ((FIELD_BITBOARD_ROW(i) + FIELD_BITBOARD_COL(i)) % FIELD_BOAT_SIZE_MEDIUM == 1 &&
+            FIELD_BITBOARD_ROW(i) < 3) {
+            GuessData miss = {FIELD_BITBOARD_ROW(i), FIELD_BITBOARD_COL(i), RESULT_MISS};
+            FieldUpdateKnowledge(&opp, &miss);
+        }
+    }
+    guess = FieldAIStateDecideGuess(&state, &opp);
+    Check((guess.row + guess.col) % FIELD_BOAT_SIZE_MEDIUM == 1 && guess.row >= 3,
+        "FieldAIHunt finishes the most covered offset");
+}
+
+/**
+ * Tests that separate FieldAIState contexts do not affect each other and that
+ * reported results drive target mode.
+ */
+void TestFieldAIState() {
+    Field opp;
+    FieldAIState hunter, chaser;
+    FieldInit(NULL, &opp);
+    FieldAIStateInit(&hunter);
+    FieldAIStateInit(&chaser);
+
+    // A hit reported to one state makes it shoot next to the hit...
+    GuessData shot = { 3, 5, RESULT_HIT };
+    FieldUpdateKnowledge(&opp, &shot);
+    FieldAIStateUpdate(&chaser, &shot);
+    GuessData guess = FieldAIStateDecideGuess(&chaser, &opp);
+    int dr = (int)guess.row - 3;
+    int dc = (int)guess.col - 5;
+    Check(dr * dr + dc * dc == 1, "FieldAIStateDecideGuess targets next to a reported hit");
+
+    // ...while the other state is left untouched
+    Check(!hunter.targeting && hunter.hits == 0, "FieldAIStateUpdate states are independent");
+
+    // A sunk result ends target mode
+    shot.row = guess.row;
+    shot.col = guess.col;
+    shot.result = RESULT_SMALL_BOAT_SUNK;
+    FieldUpdateKnowledge(&opp, &shot);
+    FieldAIStateUpdate(&chaser, &shot);
+    Check(!chaser.targeting, "FieldAIStateUpdate sunk result resets targeting");
+
+    // A hit on the edge never leads to an off-field guess
+    FieldAIStateInit(&chaser);
+    for (int i = 0; i < 8; i++) {
+        shot = FieldAIStateDecideGuess(&chaser, &opp);
+        shot.result = (i == 0) ? RESULT_HIT : RESULT_MISS;
+        if (i == 0) {
+            shot.row = 0;
+            shot.col = 0;
+        }
+        FieldUpdateKnowledge(&opp, &shot);
+        FieldAIStateUpdate(&chaser, &shot);
+        guess = FieldAIStateDecideGuess(&chaser, &opp);
+        if (guess.row >= FIELD_ROWS || guess.col >= FIELD_COLS ||
+            opp.grid[guess.row][guess.col] != FIELD_SQUARE_UNKNOWN) {
+            break;
+        }
+    }
+    Check(guess.row < FIELD_ROWS && guess.col < FIELD_COLS &&
+          opp.grid[guess.row][guess.col] == FIELD_SQUARE_UNKNOWN,
+          "FieldAIStateDecideGuess stays on the field near an edge");
+}
+
+/**
+ * Tests that FieldAttributeSunk only marks hits dead when no other assignment
+ * of the sunk boat is possible.
+ */
+void TestFieldAttributeSunk() {
+    Field opp;
+    FieldInit(NULL, &opp);
+    uint8_t sunkSquare[FIELD_NUM_BOATS];
+    FieldBitboard hitsAtSink[FIELD_NUM_BOATS];
+    for (int t = 0; t < FIELD_NUM_BOATS; t++) {
+        sunkSquare[t] = FIELD_NUM_SQUARES;
+        hitsAtSink[t] = FIELD_BITBOARD_ALL;
+    }
+
+    // Four hits in a row; the small boat sank on the third one
+    for (int col = 2; col <= 5; col++) {
+        GuessData shot = { 2, col, RESULT_HIT };
+        FieldUpdateKnowledge(&opp, &shot);
+    }
+    GuessData sink = { 2, 4, RESULT_SMALL_BOAT_SUNK };
+    FieldUpdateKnowledge(&opp, &sink);
+    sunkSquare[FIELD_BOAT_TYPE_SMALL] = FIELD_BITBOARD_INDEX(2, 4);
+
+    // The small boat is on columns 2-4 or 3-5, so only 3 and 4 are certain
+    FieldBitboard possible;
+    FieldBitboard dead = FieldAttributeSunk(&opp, sunkSquare, hitsAtSink, &possible);
+    Check(dead == (FIELD_BITBOARD_SQUARE(2, 3) | FIELD_BITBOARD_SQUARE(2, 4)) &&
+          possible == FieldGetBitboard(&opp, FIELD_SQUARE_HIT),
+          "FieldAttributeSunk leaves ambiguous ends unresolved");
+
+    // Misses around column 2 mean no live boat could have covered it
+    GuessData miss = { 1, 2, RESULT_MISS };
+    FieldUpdateKnowledge(&opp, &miss);
+    miss.row = 3;
+    FieldUpdateKnowledge(&opp, &miss);
+    miss.row = 2;
+    miss.col = 1;
+    FieldUpdateKnowledge(&opp, &miss);
+    dead = FieldAttributeSunk(&opp, sunkSquare, hitsAtSink, NULL);
+    Check(dead == (FIELD_BITBOARD_SQUARE(2, 2) | FIELD_BITBOARD_SQUARE(2, 3) |
+                   FIELD_BITBOARD_SQUARE(2, 4)),
+          "FieldAttributeSunk resolves a forced assignment");
+
+    // Nothing sunk, nothing dead
+    FieldInit(NULL, &opp);
+    Check(FieldAttributeSunk(&opp, sunkSquare, hitsAtSink, NULL) == 0,
+          "FieldAttributeSunk with no sunk boats");
+}
+
+// ------------------------- FIELD BOARD TEST --------------------------------
+
+#ifndef STM32F4
+/**
+ * Tests the runtime-configurable board on a variant with two boats of one
+ * type.
+ */
+void TestFieldBoard() {
+    static FieldBoard own, opp;
+    const FieldRules variant = { 10, 10, 4, { 2, 3, 4, 5 }, { 1, 2, 1, 1 } };
+    FieldRules crowded = variant;
+    crowded.rows = 1;
+
+    Check(FieldRulesCheck(&fieldRulesStandard) == SUCCESS && FieldRulesIsStandard(&fieldRulesStandard) &&
+          FieldRulesCheck(&variant) == SUCCESS && !FieldRulesIsStandard(&variant) &&
+          FieldRulesCheck(&crowded) == STANDARD_ERROR,
+          "FieldRulesCheck standard, variant and overfull rules");
+
+    // Boats 1 and 2 are both length 3; they may not overlap or leave the board
+    FieldBoardInit(&own, &opp, &variant);
+    Check(own.numBoats == 5 && FieldBoardGetBoatStates(&own) == 0 &&
+          FieldBoardGetBoatStates(&opp) == 0x1F &&
+          FieldBoardGetSquare(&opp, 9, 9) == FIELD_BOARD_UNKNOWN,
+          "FieldBoardInit");
+    Check(FieldBoardAddBoat(&own, 0, 0, FIELD_DIR_EAST, 1) == SUCCESS &&
+          FieldBoardAddBoat(&own, 0, 2, FIELD_DIR_SOUTH, 2) == STANDARD_ERROR &&
+          FieldBoardAddBoat(&own, 0, 8, FIELD_DIR_EAST, 2) == STANDARD_ERROR &&
+          FieldBoardAddBoat(&own, 1, 0, FIELD_DIR_EAST, 2) == SUCCESS &&
+          FieldBoardGetSquare(&own, 1, 2) == FIELD_BOARD_BOAT(2),
+          "FieldBoardAddBoat overlap and bounds");
+
+    // Sinking boat 1 reports it and the opponent's view follows
+    uint8_t sunk = FIELD_BOARD_NO_BOAT;
+    for (int col = 0; col < 3; col++) {
+        GuessData shot = { 0, col, RESULT_MISS };
+        sunk = FieldBoardRegisterAttack(&own, &shot);
+        FieldBoardUpdateKnowledge(&opp, &shot, sunk);
+    }
+    GuessData miss = { 5, 5, RESULT_HIT };
+    FieldBoardRegisterAttack(&own, &miss);
+    Check(sunk == 1 && FieldBoardGetBoatStates(&own) == 0x04 &&
+          FieldBoardGetBoatStates(&opp) == 0x1D && miss.result == RESULT_MISS &&
+          FieldBoardGetSquare(&opp, 0, 1) == FIELD_BOARD_HIT,
+          "FieldBoardRegisterAttack sinks one of two equal boats");
+
+    // A random fleet covers exactly the fleet's squares
+    FieldBoardInit(&own, NULL, &variant);
+    int boatSquares = 0;
+    uint8_t placed = FieldBoardPlaceAllBoats(&own, RngDefault());
+    for (int r = 0; r < variant.rows; r++) {
+        for (int c = 0; c < variant.cols; c++) {
+            boatSquares += (FieldBoardGetSquare(&own, r, c) != FIELD_BOARD_EMPTY);
+        }
+    }
+    Check(placed == SUCCESS && boatSquares == 17 && FieldBoardGetBoatStates(&own) == 0x1F,
+          "FieldBoardPlaceAllBoats");
+
+    // Row bitsets reach the last column and row of a 64x64 board
+    const FieldRules wide = { 64, 64, 1, { 5 }, { 2 } };
+    FieldBoardInit(&own, NULL, &wide);
+    Check(FieldBoardAddBoat(&own, 59, 63, FIELD_DIR_SOUTH, 0) == SUCCESS &&
+          FieldBoardAddBoat(&own, 63, 60, FIELD_DIR_EAST, 1) == STANDARD_ERROR &&
+          FieldBoardAddBoat(&own, 63, 58, FIELD_DIR_EAST, 1) == SUCCESS &&
+          FieldBoardGetRow(&own, FIELD_BOARD_BOAT(0), 63) == (0x3Full << 58) &&
+          FieldBoardGetSquare(&own, 63, 63) == FIELD_BOARD_BOAT(0) &&
+          FieldBoardGetSquare(&own, 63, 62) == FIELD_BOARD_BOAT(1),
+          "FieldBoard row bitsets on a 64x64 board");
+    Check(FieldBoardSetSquare(&own, 0, 0, FIELD_BOARD_MISS) == FIELD_BOARD_EMPTY &&
+          FieldBoardSetSquare(&own, 63, 63, FIELD_BOARD_MISS) == FIELD_BOARD_NO_BOAT &&
+          FieldBoardGetRow(&own, FIELD_BOARD_MISS, 0) == 1,
+          "FieldBoardSetSquare leaves boats alone");
+
+    // Whole games finish on both the fast and the generic path
+    uint16_t fast = FieldBoardShotsToWin(&fieldRulesStandard, RngDefault());
+    uint16_t generic = FieldBoardShotsToWin(&variant, RngDefault());
+    Check(fast >= 18 && fast <= FIELD_NUM_SQUARES && generic >= 17 && generic <= 100,
+          "FieldBoardShotsToWin standard and variant");
+}
+#endif
+
 // ------------------------------ MAIN FUNCTION -------------------------------
 
 /**
@@ -375,10 +879,22 @@ int main(void) {
     Test_FieldSetSquareStatus();
     TestFieldAddBoat();
     TestFieldRegisterEnemyAttack();
+    TestFieldBoatTable();
     TestFieldUpdateKnowledge();
     TestFieldGetBoatStates();
+    TestFieldBitboards();
+    TestFieldHash();
+#ifndef STM32F4
+    TestFieldPacked();  // Host only, like FieldPacked.c
+#endif
     TestFieldAIPlaceAllBoats();
     TestFieldAIDecideGuess();
+    TestFieldAIHunt();
+    TestFieldAIState();
+    TestFieldAttributeSunk();
+#ifndef STM32F4
+    TestFieldBoard();   // Host only, like FieldBoard.c
+#endif
 
     printf("\n=== All tests finished ===\n");
 
@@ -29,6 +29,7 @@
 #include "Negotiation.h"
 #include "Message.h"
 #include "Field.h"
+#include "Rng.h"
 
 
 /*  PROTOTYPES  */
@@ -42,7 +43,7 @@ void setup(void);
 // Trace Mode:  Print a trace of events as they are detected:
 //#define TRACE_MODE
 
-// Unseeded Mode:  Do not reseed rand, and seed with switches (useful for
+// Unseeded Mode:  Do not reseed the RNG, and seed with switches (useful for
 // creating repeatable tests):
 //#define UNSEEDED_MODE
 
@@ -55,15 +56,20 @@ void setup(void);
 #define debug_printf printf
 #endif
 
+// The AI draws from RngDefault(); rand() is still seeded for the prebuilt
+// HumanAgent.o.
 #ifdef UNSEEDED_MODE
 #define seed_rand(x) 
-#define AgentInit() {srand(SWITCH_STATES()); AgentInit();}
+#define AgentInit() {srand(SWITCH_STATES()); RngSeed(RngDefault(), SWITCH_STATES()); AgentInit();}
 #else
-#define seed_rand(x) srand(x)
+#define seed_rand(x) do {srand(rand() + (x)); RngMix(RngDefault(), (x));} while (0)
 #endif
 
 // The amount of time between UART updates (in 100ths of a second).
 #define TRANSMIT_PERIOD     1
+
+// htim2 advances freeRunningTimer once per 100th of a second.
+#define FREE_RUNNING_TIMER_PERIOD_US    10000
 #define UART_BUFFER_SIZE    (MESSAGE_MAX_LEN + 1)
 
 /*  Static data for BattleBoats top level:  */
@@ -189,7 +195,7 @@ void Transmission_ReceiveMessage(void)
     }
 
     // Also, re-seed our random number using the time:
-    seed_rand(rand() + freeRunningTimer);
+    seed_rand(freeRunningTimer);
 }
 
 // Functions that stringify state names and event names for display.
@@ -342,7 +348,7 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
         }
 
         // Also, re-seed our random number using the time.
-        if (buttonEvent) seed_rand(rand() + freeRunningTimer);
+        if (buttonEvent) seed_rand(freeRunningTimer);
 
         // Every TRANSMIT_PERIOD cycles, attempt to run the transmission module.
         if (freeRunningTimer % TRANSMIT_PERIOD == 0)
@@ -407,6 +413,28 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
     }
 }
 
+/** FieldAIMicros()
+ *
+ * Microsecond clock for the AI's time limits, read from htim2. freeRunningTimer
+ * counts whole timer periods and the counter register gives the position within
+ * the current one. Re-reads if the period rolled over in between.
+ *
+ * @return  The current time in microseconds.
+ */
+uint32_t FieldAIMicros(void)
+{
+    uint32_t ticks, count;
+    do
+    {
+        ticks = *(volatile uint32_t *)&freeRunningTimer;
+        count = __HAL_TIM_GET_COUNTER(&htim2);
+    } while (ticks != *(volatile uint32_t *)&freeRunningTimer);
+
+    uint32_t period = __HAL_TIM_GET_AUTORELOAD(&htim2) + 1;
+    return ticks * FREE_RUNNING_TIMER_PERIOD_US +
+           (uint32_t)((uint64_t)count * FREE_RUNNING_TIMER_PERIOD_US / period);
+}
+
 // Provide weak implementations for students that didn't implement every
 // function.
 __attribute__((weak)) GuessData FieldAIDecideGuess(const Field *opp_field)
@@ -0,0 +1,169 @@
+/**
+ * @file    Rng.c
+ *
+ * xoshiro256** with splitmix64 seeding.
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+
+#include "Rng.h"
+
+/*  MODULE-LEVEL DEFINITIONS, MACROS    */
+
+// The state RngSeed(&rng, 0) produces
+static Rng rngDefault = {{
+    0xE220A8397B1DCDAFull, 0x6E789E6AA1B965F4ull,
+    0x06C45D188009454Full, 0xF88BB8A8724C81ECull
+}};
+
+// Jump polynomial for 2^128 steps, from the xoshiro256 reference code
+static const uint64_t rngJump[4] = {
+    0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+    0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+};
+
+
+/*  PRIVATE FUNCTIONS   */
+
+static uint64_t RngRotate(uint64_t x, uint8_t k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t RngSplitMix(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+
+/*  PROTOTYPES  */
+
+/** RngSeed(*rng, seed)
+ *
+ * @param   *rng    The generator.
+ * @param   seed    Any value.
+ */
+void RngSeed(Rng *rng, uint64_t seed)
+{
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        rng->s[i] = RngSplitMix(&seed);
+    }
+}
+
+/** RngNext(*rng)
+ *
+ * @param   *rng    The generator.
+ * @return  64 random bits.
+ */
+uint64_t RngNext(Rng *rng)
+{
+    uint64_t *s = rng->s;
+    uint64_t result = RngRotate(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = RngRotate(s[3], 45);
+
+    return result;
+}
+
+/** RngBelow(*rng, bound)
+ *
+ * Lemire's multiply-shift: the high half of a 32x32 product is the draw, and
+ * the few low halves that would bias it are rejected.
+ *
+ * @param   *rng    The generator.
+ * @param   bound   The number of outcomes.
+ * @return  The draw, or 0 if bound is 0.
+ */
+uint32_t RngBelow(Rng *rng, uint32_t bound)
+{
+    uint64_t m = (RngNext(rng) >> 32) * bound;
+    if ((uint32_t)m < bound)
+    {
+        uint32_t threshold = (uint32_t)(-bound) % bound;
+        while ((uint32_t)m < threshold)
+        {
+            m = (RngNext(rng) >> 32) * bound;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+/** RngJump(*rng)
+ *
+ * @param   *rng    The generator.
+ */
+void RngJump(Rng *rng)
+{
+    uint64_t s[4] = {0, 0, 0, 0};
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        for (uint8_t b = 0; b < 64; b++)
+        {
+            if (rngJump[i] & (1ull << b))
+            {
+                s[0] ^= rng->s[0];
+                s[1] ^= rng->s[1];
+                s[2] ^= rng->s[2];
+                s[3] ^= rng->s[3];
+            }
+            RngNext(rng);
+        }
+    }
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        rng->s[i] = s[i];
+    }
+}
+
+/** RngSplit(*rng, *stream)
+ *
+ * @param   *rng    The parent generator.
+ * @param   *stream Receives the new stream.
+ */
+void RngSplit(Rng *rng, Rng *stream)
+{
+    *stream = *rng;
+    RngJump(rng);
+}
+
+/** RngMix(*rng, entropy)
+ *
+ * Each word of the state absorbs its own splitmix64 output of the entropy,
+ * then one draw spreads it through the rest.
+ *
+ * @param   *rng    The generator.
+ * @param   entropy Any value.
+ */
+void RngMix(Rng *rng, uint64_t entropy)
+{
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        rng->s[i] ^= RngSplitMix(&entropy);
+    }
+    if (!(rng->s[0] | rng->s[1] | rng->s[2] | rng->s[3]))
+    {
+        rng->s[0] = 1;
+    }
+    RngNext(rng);
+}
+
+/** RngDefault()
+ *
+ * @return  The generator used where no Rng is passed.
+ */
+Rng *RngDefault(void)
+{
+    return &rngDefault;
+}
@@ -0,0 +1,346 @@
+/**
+ * @file    FieldLayoutOpt.c
+ *
+ * Host-side optimizer that writes src/FieldLayoutTable.c. It draws uniform
+ * fleets and plays each against the hunters in this repo, in parallel. The
+ * fleets that last longest are kept, weighted, and printed as the table
+ * declared in FieldLayout.h.
+ *
+ * Then fresh games compare the tuned table with uniform placement. Each arm
+ * reports mean shots-to-win with a 95% confidence interval. The parity and
+ * density hunters are deterministic, so their games are the ones the table
+ * was selected on. The sampling hunter is never used for selection, so it
+ * shows whether the gain carries over to a hunter the table was not tuned
+ * against. The report goes to stderr and into the header of the table.
+ *
+ * @usage   `$ make layouts`
+ *          `$ ./FieldLayoutOpt [candidates] [games] [seed] [threads] > src/FieldLayoutTable.c`
+ *
+ * @date    16 Oct 2026
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldCount.h"
+#include "FieldDensity.h"
+#include "FieldLayout.h"
+#include "FieldPlacement.h"
+#include "FieldSampler.h"
+#include "Rng.h"
+
+#define DEFAULT_CANDIDATES 20000
+#define DEFAULT_GAMES 2000
+#define DEFAULT_THREADS 4
+
+// Samples per shot for the sampling hunter
+#define SAMPLER_HUNTER_SAMPLES 200
+
+// Largest weight given to a kept layout; the weakest kept layout gets 1
+#define MAX_WEIGHT 16
+
+typedef enum {
+    HUNTER_PARITY,      // FieldAIStateDecideGuess()
+    HUNTER_DENSITY,     // FieldDensityDecideGuess()
+    HUNTER_SAMPLER,     // FieldSamplerRun() + FieldSamplerBestGuess(), held out
+    NUM_HUNTERS
+} Hunter;
+
+static const char *hunterNames[NUM_HUNTERS] = {"parity", "density", "sampler (held out)"};
+
+/**
+ * One game to play: a layout, a hunter and a seed for the hunter's RNG.
+ */
+typedef struct {
+    const FieldLayout *layout;
+    uint64_t seed;
+    uint8_t hunter;
+    uint8_t shots;
+} Game;
+
+typedef struct {
+    Game *games;
+    uint32_t count;
+    uint32_t first;
+    uint32_t step;
+} Worker;
+
+typedef struct {
+    double mean;
+    double half;    // Half-width of the 95% confidence interval
+} Interval;
+
+static FieldCount count;
+
+/**
+ * Reads back the placement index of every boat on a field.
+ */
+static void LayoutFromField(const Field *field, FieldLayout *layout)
+{
+    const SquareStatus planes[FIELD_NUM_BOATS] = {
+        FIELD_SQUARE_SMALL_BOAT, FIELD_SQUARE_MEDIUM_BOAT,
+        FIELD_SQUARE_LARGE_BOAT, FIELD_SQUARE_HUGE_BOAT};
+
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        FieldBitboard boat = FieldGetBitboard(field, planes[type]);
+        for (uint16_t p = fieldPlacementFirst[type]; p < fieldPlacementFirst[type + 1]; p++)
+        {
+            if (fieldPlacements[p].mask == boat)
+            {
+                layout->placement[type] = (uint8_t)p;
+            }
+        }
+    }
+    layout->weight = 1;
+}
+
+/**
+ * Adds the boats of `layout` to `field`. The same as FieldLayoutPlace(), which
+ * is not linked in here because it sits next to the table being generated.
+ */
+static void PlaceLayout(const FieldLayout *layout, Field *field)
+{
+    for (uint8_t type = 0; type < FIELD_NUM_BOATS; type++)
+    {
+        const FieldPlacement *p = &fieldPlacements[layout->placement[type]];
+        FieldAddBoat(field, p->row, p->col, p->dir, p->type);
+    }
+}
+
+/**
+ * Plays one hunter against `layout` and returns the shots it needed.
+ */
+static uint8_t ShotsToWin(const FieldLayout *layout, Hunter hunter, uint64_t seed)
+{
+    Field target;
+    Field knowledge;
+    FieldAIState state;
+    FieldSampler sampler;
+    Rng rng;
+
+    FieldInit(&target, &knowledge);
+    PlaceLayout(layout, &target);
+    RngSeed(&rng, seed);
+    FieldAIStateInitRng(&state, &rng);
+    FieldSamplerInit(&sampler, seed);
+
+    uint8_t shots = 0;
+    while (FieldGetBoatStates(&target) && shots < FIELD_NUM_SQUARES)
+    {
+        GuessData guess;
+        switch (hunter)
+        {
+        case HUNTER_PARITY:
+            guess = FieldAIStateDecideGuess(&state, &knowledge);
+            break;
+        case HUNTER_DENSITY:
+            guess = FieldDensityDecideGuess(&knowledge);
+            break;
+        default:
+            FieldSamplerRun(&sampler, &knowledge, SAMPLER_HUNTER_SAMPLES, 0);
+            guess = FieldSamplerBestGuess(&sampler, &knowledge);
+            break;
+        }
+        FieldRegisterEnemyAttack(&target, &guess);
+        FieldUpdateKnowledge(&knowledge, &guess);
+        FieldAIStateUpdate(&state, &guess);
+        shots++;
+    }
+    return shots;
+}
+
+static void *WorkerRun(void *arg)
+{
+    Worker *w = arg;
+    for (uint32_t i = w->first; i < w->count; i += w->step)
+    {
+        Game *g = &w->games[i];
+        g->shots = ShotsToWin(g->layout, g->hunter, g->seed);
+    }
+    return NULL;
+}
+
+/**
+ * Plays every game, spread over `threads` threads.
+ */
+static void PlayAll(Game *games, uint32_t n, uint32_t threads)
+{
+    pthread_t tid[threads];
+    Worker workers[threads];
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        workers[t].games = games;
+        workers[t].count = n;
+        workers[t].first = t;
+        workers[t].step = threads;
+        pthread_create(&tid[t], NULL, WorkerRun, &workers[t]);
+    }
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        pthread_join(tid[t], NULL);
+    }
+}
+
+/**
+ * Mean and 95% confidence interval of the shots of games[first], games[first
+ * + step], ... (n games).
+ */
+static Interval Summarize(const Game *games, uint32_t first, uint32_t step, uint32_t n)
+{
+    double sum = 0;
+    double squares = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        double s = games[first + i * step].shots;
+        sum += s;
+        squares += s * s;
+    }
+    Interval r;
+    r.mean = sum / n;
+    double var = (squares - sum * sum / n) / (n > 1 ? n - 1 : 1);
+    r.half = 1.96 * sqrt(var / n);
+    return r;
+}
+
+static int CompareScores(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x < y) - (x > y);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t candidates = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_CANDIDATES;
+    uint32_t games = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : DEFAULT_GAMES;
+    unsigned seed = (argc > 3) ? (unsigned)strtoul(argv[3], NULL, 10) : 1;
+    uint32_t threads = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 10) : DEFAULT_THREADS;
+    if (candidates < FIELD_NUM_LAYOUTS || games < 2 || threads < 1)
+    {
+        fprintf(stderr, "need at least %u candidates, 2 games and 1 thread\n", FIELD_NUM_LAYOUTS);
+        return 1;
+    }
+    Rng rng;
+    RngSeed(&rng, seed);
+    FieldCountInit(&count);
+
+    // Score uniform candidates against the hunters being tuned for
+    FieldLayout *pool = malloc(candidates * sizeof(*pool));
+    Game *play = malloc(candidates * 2 * sizeof(*play));
+    for (uint32_t c = 0; c < candidates; c++)
+    {
+        Field field;
+        FieldInit(&field, NULL);
+        FieldCountSample(&count, &field, &rng);
+        LayoutFromField(&field, &pool[c]);
+        for (uint8_t h = HUNTER_PARITY; h <= HUNTER_DENSITY; h++)
+        {
+            play[2 * c + h].layout = &pool[c];
+            play[2 * c + h].hunter = h;
+            play[2 * c + h].seed = FieldSamplerSeed(seed, c);
+        }
+    }
+    PlayAll(play, candidates * 2, threads);
+
+    // Keep the best FIELD_NUM_LAYOUTS by mean shots over the hunters
+    double (*scores)[2] = malloc(candidates * sizeof(*scores));
+    for (uint32_t c = 0; c < candidates; c++)
+    {
+        scores[c][0] = (play[2 * c].shots + play[2 * c + 1].shots) / 2.0;
+        scores[c][1] = c;
+    }
+    qsort(scores, candidates, sizeof(*scores), CompareScores);
+
+    FieldLayout kept[FIELD_NUM_LAYOUTS];
+    double best = scores[0][0];
+    double worst = scores[FIELD_NUM_LAYOUTS - 1][0];
+    uint16_t weightTotal = 0;
+    for (uint16_t k = 0; k < FIELD_NUM_LAYOUTS; k++)
+    {
+        kept[k] = pool[(uint32_t)scores[k][1]];
+        kept[k].weight = 1;
+        if (best > worst)
+        {
+            kept[k].weight += (uint8_t)lround((MAX_WEIGHT - 1) * (scores[k][0] - worst) / (best - worst));
+        }
+        weightTotal += kept[k].weight;
+    }
+
+    // Fresh games: uniform placement against the tuned table, every hunter
+    Game *eval = malloc(games * 2 * NUM_HUNTERS * sizeof(*eval));
+    FieldLayout *fresh = malloc(games * 2 * sizeof(*fresh));
+    for (uint32_t g = 0; g < games; g++)
+    {
+        Field field;
+        FieldInit(&field, NULL);
+        FieldCountSample(&count, &field, &rng);
+        LayoutFromField(&field, &fresh[2 * g]);
+
+        uint16_t r = RngBelow(&rng, weightTotal);
+        uint16_t k = 0;
+        while (r >= kept[k].weight)
+        {
+            r -= kept[k].weight;
+            k++;
+        }
+        fresh[2 * g + 1] = kept[k];
+
+        for (uint8_t arm = 0; arm < 2; arm++)
+        {
+            for (uint8_t h = 0; h < NUM_HUNTERS; h++)
+            {
+                Game *e = &eval[(g * 2 + arm) * NUM_HUNTERS + h];
+                e->layout = &fresh[2 * g + arm];
+                e->hunter = h;
+                e->seed = FieldSamplerSeed(seed + 1, g);
+            }
+        }
+    }
+    PlayAll(eval, games * 2 * NUM_HUNTERS, threads);
+
+    char report[NUM_HUNTERS][128];
+    for (uint8_t h = 0; h < NUM_HUNTERS; h++)
+    {
+        Interval uniform = Summarize(eval, h, 2 * NUM_HUNTERS, games);
+        Interval tuned = Summarize(eval, NUM_HUNTERS + h, 2 * NUM_HUNTERS, games);
+        snprintf(report[h], sizeof(report[h]), "%-20s uniform %5.2f +/- %.2f   tuned %5.2f +/- %.2f",
+                 hunterNames[h], uniform.mean, uniform.half, tuned.mean, tuned.half);
+        fprintf(stderr, "%s\n", report[h]);
+    }
+
+    printf("/**\n");
+    printf(" * @file    FieldLayoutTable.c\n");
+    printf(" *\n");
+    printf(" * GENERATED by tools/FieldLayoutOpt.c -- do not edit by hand.\n");
+    printf(" *\n");
+    printf(" * %u candidates, %u evaluation games per arm, seed %u.\n", candidates, games, seed);
+    printf(" * Opponent shots-to-win, mean +/- 95%% confidence interval:\n");
+    for (uint8_t h = 0; h < NUM_HUNTERS; h++)
+    {
+        printf(" *   %s\n", report[h]);
+    }
+    printf(" */\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#include \"FieldLayout.h\"\n\n");
+    printf("const uint16_t fieldLayoutWeightTotal = %u;\n\n", weightTotal);
+    printf("const FieldLayout fieldLayouts[FIELD_NUM_LAYOUTS] = {\n");
+    for (uint16_t k = 0; k < FIELD_NUM_LAYOUTS; k++)
+    {
+        printf("    {{%3u, %3u, %3u, %3u}, %2u},\n", kept[k].placement[0], kept[k].placement[1],
+               kept[k].placement[2], kept[k].placement[3], kept[k].weight);
+    }
+    printf("};\n");
+
+    free(pool);
+    free(play);
+    free(scores);
+    free(eval);
+    free(fresh);
+    return 0;
+}
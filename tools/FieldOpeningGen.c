@@ -0,0 +1,117 @@
+/**
+ * @file    FieldOpeningGen.c
+ *
+ * Host-side generator for src/FieldOpeningTable.c. It walks every hit/miss
+ * sequence of the first FIELD_OPENING_DEPTH shots, solves each field exactly
+ * with FieldExactSolve() and keeps the square with the highest posterior hit
+ * probability. Fields that no fleet is consistent with get FIELD_OPENING_NONE.
+ *
+ * The same solves give the expected number of hits over the book's shots,
+ * against a uniformly placed fleet. The density hunter's choices are scored on
+ * the same fields for comparison. Both go to stderr and into the header of the
+ * table.
+ *
+ * @usage   `$ make opening`
+ *          `$ ./FieldOpeningGen > src/FieldOpeningTable.c`
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "BOARD.h"
+#include "Field.h"
+#include "FieldDensity.h"
+#include "FieldExact.h"
+#include "FieldOpening.h"
+
+static uint8_t book[FIELD_OPENING_NODES];
+static double bookHits;         // Expected hits over the book's shots
+static double densityHits;      // The same for the density hunter's shots
+static uint32_t solves;
+
+static uint64_t NowNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * Fills the subtree rooted at `node`, which stands for `field`. `reach` is
+ * the chance that a game against a uniform fleet gets there.
+ */
+static void Build(uint16_t node, const Field *field, double reach)
+{
+    FieldExact exact;
+    solves++;
+    if (FieldExactSolve(&exact, field) == 0)
+    {
+        book[node] = FIELD_OPENING_NONE;
+        return;
+    }
+
+    GuessData guess = FieldExactBestGuess(&exact, field);
+    uint8_t square = FIELD_BITBOARD_INDEX(guess.row, guess.col);
+    double hit = (double)exact.tally[square] / exact.total;
+    book[node] = square;
+    bookHits += reach * hit;
+
+    GuessData density = FieldDensityDecideGuess(field);
+    densityHits += reach * exact.tally[FIELD_BITBOARD_INDEX(density.row, density.col)] /
+            exact.total;
+
+    if (2 * node + 2 >= FIELD_OPENING_NODES)
+    {
+        return;
+    }
+    Field next = *field;
+    guess.result = RESULT_MISS;
+    FieldUpdateKnowledge(&next, &guess);
+    Build(2 * node + 1, &next, reach * (1 - hit));
+
+    next = *field;
+    guess.result = RESULT_HIT;
+    FieldUpdateKnowledge(&next, &guess);
+    Build(2 * node + 2, &next, reach * hit);
+}
+
+int main(void)
+{
+    Field field;
+    FieldInit(NULL, &field);
+    memset(book, FIELD_OPENING_NONE, sizeof(book));
+
+    uint64_t start = NowNanos();
+    Build(0, &field, 1.0);
+    double seconds = (NowNanos() - start) / 1e9;
+
+    // The density hunter's shots only match the book's while they agree, so
+    // its score is a per-field comparison, not a whole game
+    char report[160];
+    snprintf(report, sizeof(report),
+             "Expected hits in the book's %u shots: exact %.3f, density %.3f",
+             FIELD_OPENING_DEPTH, bookHits, densityHits);
+    fprintf(stderr, "%s\n%u solves in %.1f s\n", report, solves, seconds);
+
+    printf("/**\n");
+    printf(" * @file    FieldOpeningTable.c\n");
+    printf(" *\n");
+    printf(" * GENERATED by tools/FieldOpeningGen.c -- do not edit by hand.\n");
+    printf(" *\n");
+    printf(" * %s\n", report);
+    printf(" * (per field on the book's path, against a uniformly placed fleet).\n");
+    printf(" */\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#include \"FieldOpening.h\"\n\n");
+    printf("const uint8_t fieldOpeningBook[FIELD_OPENING_NODES] = {\n");
+    for (uint16_t node = 0; node < FIELD_OPENING_NODES; node++)
+    {
+        printf("%s%3u,%s", (node % 16) ? " " : "    ", book[node],
+               (node % 16 == 15 || node == FIELD_OPENING_NODES - 1) ? "\n" : "");
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    FieldPlacementGen.c
+ *
+ * Host-side generator for src/FieldPlacementTable.c. It enumerates every
+ * legal placement of each BoatType on a FIELD_ROWS x FIELD_COLS field, works
+ * out the hunt lattices, and prints the tables declared in FieldPlacement.h as
+ * C source.
+ *
+ * @usage   `$ make src/FieldPlacementTable.c`
+ *          (pass the same -DFIELD_ROWS/-DFIELD_COLS as the firmware build)
+ *
+ * @date    16 Oct 2026
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "Field.h"
+#include "FieldPlacement.h"
+
+static const uint8_t sizes[FIELD_NUM_BOATS] = {
+    FIELD_BOAT_SIZE_SMALL,
+    FIELD_BOAT_SIZE_MEDIUM,
+    FIELD_BOAT_SIZE_LARGE,
+    FIELD_BOAT_SIZE_HUGE};
+
+static const char *typeNames[FIELD_NUM_BOATS] = {
+    "FIELD_BOAT_TYPE_SMALL",
+    "FIELD_BOAT_TYPE_MEDIUM",
+    "FIELD_BOAT_TYPE_LARGE",
+    "FIELD_BOAT_TYPE_HUGE"};
+
+static const char *dirNames[2] = {
+    "FIELD_DIR_SOUTH",
+    "FIELD_DIR_EAST"};
+
+/**
+ * Returns the mask of a boat, or 0 if it does not fit on the field.
+ */
+static FieldBitboard PlacementMask(int row, int col, int dir, int size)
+{
+    if ((dir == FIELD_DIR_EAST && col + size > FIELD_COLS) ||
+        (dir == FIELD_DIR_SOUTH && row + size > FIELD_ROWS))
+    {
+        return 0;
+    }
+
+    FieldBitboard mask = 0;
+    for (int i = 0; i < size; i++)
+    {
+        int r = row + ((dir == FIELD_DIR_SOUTH) ? i : 0);
+        int c = col + ((dir == FIELD_DIR_EAST) ? i : 0);
+        mask |= FIELD_BITBOARD_SQUARE(r, c);
+    }
+    return mask;
+}
+
+int main(void)
+{
+    printf("/**\n");
+    printf(" * @file    FieldPlacementTable.c\n");
+    printf(" *\n");
+    printf(" * GENERATED by tools/FieldPlacementGen.c -- do not edit by hand.\n");
+    printf(" * Regenerate with `make src/FieldPlacementTable.c`.\n");
+    printf(" */\n");
+    printf("#include <stdint.h>\n\n");
+    printf("#include \"Field.h\"\n");
+    printf("#include \"FieldPlacement.h\"\n\n");
+    printf("#if FIELD_ROWS != %d || FIELD_COLS != %d\n", FIELD_ROWS, FIELD_COLS);
+    printf("#error \"FieldPlacementTable.c was generated for a %dx%d field; regenerate it.\"\n",
+           FIELD_ROWS, FIELD_COLS);
+    printf("#endif\n\n");
+
+    printf("const uint8_t fieldBoatSizes[FIELD_NUM_BOATS] = {");
+    for (int t = 0; t < FIELD_NUM_BOATS; t++)
+    {
+        printf("%s%d", t ? ", " : "", sizes[t]);
+    }
+    printf("};\n\n");
+
+    // Flat list of placements, grouped by type
+    int first[FIELD_NUM_BOATS + 1];
+    int count = 0;
+    printf("const FieldPlacement fieldPlacements[FIELD_NUM_PLACEMENTS] = {\n");
+    for (int t = 0; t < FIELD_NUM_BOATS; t++)
+    {
+        first[t] = count;
+        for (int row = 0; row < FIELD_ROWS; row++)
+        {
+            for (int col = 0; col < FIELD_COLS; col++)
+            {
+                for (int dir = 0; dir < 2; dir++)
+                {
+                    FieldBitboard mask = PlacementMask(row, col, dir, sizes[t]);
+                    if (mask)
+                    {
+                        printf("    {0x%016" PRIx64 "ull, %d, %d, %s, %s},\n",
+                               mask, row, col, dirNames[dir], typeNames[t]);
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+    first[FIELD_NUM_BOATS] = count;
+    printf("};\n\n");
+
+    printf("const uint16_t fieldPlacementFirst[FIELD_NUM_BOATS + 1] = {");
+    for (int t = 0; t <= FIELD_NUM_BOATS; t++)
+    {
+        printf("%s%d", t ? ", " : "", first[t]);
+    }
+    printf("};\n\n");
+
+    // Direct lookup by (type, row, col, dir)
+    printf("const FieldBitboard fieldPlacementMasks[FIELD_NUM_BOATS][FIELD_ROWS][FIELD_COLS][2] = {\n");
+    for (int t = 0; t < FIELD_NUM_BOATS; t++)
+    {
+        printf("    { // %s\n", typeNames[t]);
+        for (int row = 0; row < FIELD_ROWS; row++)
+        {
+            printf("        {");
+            for (int col = 0; col < FIELD_COLS; col++)
+            {
+                printf("%s{0x%" PRIx64 "ull, 0x%" PRIx64 "ull}",
+                       col ? ", " : "",
+                       PlacementMask(row, col, FIELD_DIR_SOUTH, sizes[t]),
+                       PlacementMask(row, col, FIELD_DIR_EAST, sizes[t]));
+            }
+            printf("},\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    // One lattice per offset, spaced by each boat's length
+    printf("const FieldBitboard fieldHuntLattices[FIELD_NUM_BOATS][FIELD_HUNT_MAX_SPACING] = {\n");
+    for (int t = 0; t < FIELD_NUM_BOATS; t++)
+    {
+        printf("    {");
+        for (int offset = 0; offset < FIELD_HUNT_MAX_SPACING; offset++)
+        {
+            FieldBitboard lattice = 0;
+            for (int row = 0; row < FIELD_ROWS && offset < sizes[t]; row++)
+            {
+                for (int col = 0; col < FIELD_COLS; col++)
+                {
+                    if ((row + col) % sizes[t] == offset)
+                    {
+                        lattice |= FIELD_BITBOARD_SQUARE(row, col);
+                    }
+                }
+            }
+            printf("%s0x%016" PRIx64 "ull", offset ? ", " : "", lattice);
+        }
+        printf("}, // %s\n", typeNames[t]);
+    }
+    printf("};\n");
+
+    if (count != FIELD_NUM_PLACEMENTS)
+    {
+        fprintf(stderr, "FieldPlacementGen: counted %d placements, expected %d\n",
+                count, FIELD_NUM_PLACEMENTS);
+        return 1;
+    }
+    return 0;
+}